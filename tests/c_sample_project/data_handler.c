@@ -1,10 +1,21 @@
 // c_sample_project/src/data_handler.c
 
+#define _POSIX_C_SOURCE 200809L // For writev/open under -std=c99
+
 #include "data_handler.h"
+#include "item_batch_abi.h" // Shared C/C++ columnar batch layout
 #include <stdio.h>    // For printf, snprintf (used for logging/debug)
 #include <stdlib.h>   // For malloc, free
 #include <string.h>   // For strcpy, strlen
 #include <stdarg.h>   // For va_list, etc. if we were to implement a printf-like logger
+#include <pthread.h>  // For the parallel loader threads
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>    // For open
+#include <sys/uio.h>  // For writev
+#include <unistd.h>   // For write, close
+#define DATA_HANDLER_HAS_WRITEV 1
+#endif
 
 // Helper for logging (simplistic)
 // In a real application, use a proper logging library or more robust functions.
@@ -48,6 +59,16 @@ DataHandler* data_handler_create(const char* dataSourcePath) {
     }
     strcpy(handler->dataSourcePath, dataSourcePath);
 
+    // Slab sizes default to values suitable for typical load batches; the
+    // allocator grows by whole slabs as needed.
+    handler->itemSlab = item_slab_create(0, 0);
+    if (handler->itemSlab == NULL) {
+        LOG_ERROR("Failed to create item slab allocator for DataHandler.");
+        free(handler->dataSourcePath);
+        free(handler);
+        return NULL;
+    }
+
     LOG_INFO("DataHandler initialized for source: %s", handler->dataSourcePath);
     return handler;
 }
@@ -62,6 +83,7 @@ void data_handler_destroy(DataHandler** handler_ptr) {
             free(handler->dataSourcePath);
             handler->dataSourcePath = NULL;
         }
+        item_slab_destroy(&handler->itemSlab);
         free(handler);
         *handler_ptr = NULL;
         LOG_INFO("DataHandler destroyed.");
@@ -79,6 +101,23 @@ typedef struct {
 } SimulatedRawItem;
 
 
+/**
+ * @brief Returns the shared simulated raw records and their count.
+ *
+ * Shared by the serial and parallel loaders so both see the same input.
+ */
+static const SimulatedRawItem* simulated_raw_items(int* count) {
+    static const SimulatedRawItem simulated_data[] = {
+        {1, "Gadget Alpha", 150.75, true, true, true},
+        {2, "Widget Beta", 85.0, true, true, true},
+        {3, "Thingamajig Gamma", 210.5, true, true, true},
+        {4, "Doohickey Delta", 55.2, true, true, true},
+        {0, "Invalid Item (Missing ID)", 10.0, false, true, true} // Example of an invalid item
+    };
+    *count = (int)(sizeof(simulated_data) / sizeof(simulated_data[0]));
+    return simulated_data;
+}
+
 /**
  * @brief Simulate loading items from the data source.
  */
@@ -92,14 +131,8 @@ Item** data_handler_loadItems(DataHandler* handler, int* num_items_loaded) {
     LOG_INFO("Simulating loading items from %s...", handler->dataSourcePath);
     *num_items_loaded = 0;
 
-    SimulatedRawItem simulated_data[] = {
-        {1, "Gadget Alpha", 150.75, true, true, true},
-        {2, "Widget Beta", 85.0, true, true, true},
-        {3, "Thingamajig Gamma", 210.5, true, true, true},
-        {4, "Doohickey Delta", 55.2, true, true, true},
-        {0, "Invalid Item (Missing ID)", 10.0, false, true, true} // Example of an invalid item
-    };
-    int num_simulated_items = sizeof(simulated_data) / sizeof(simulated_data[0]);
+    int num_simulated_items = 0;
+    const SimulatedRawItem* simulated_data = simulated_raw_items(&num_simulated_items);
 
     // Allocate array of Item pointers
     Item** items_array = (Item**)malloc(num_simulated_items * sizeof(Item*));
@@ -112,7 +145,11 @@ Item** data_handler_loadItems(DataHandler* handler, int* num_items_loaded) {
     for (int i = 0; i < num_simulated_items; ++i) {
         // Basic validation similar to Python example
         if (simulated_data[i].has_id && simulated_data[i].has_name && simulated_data[i].has_value) {
-            Item* newItem = item_create(
+            // Items come out of the handler's slab allocator: no per-item
+            // malloc, and the whole load is reclaimed by
+            // data_handler_releaseItems with item_slab_reset.
+            Item* newItem = item_slab_alloc(
+                handler->itemSlab,
                 simulated_data[i].item_id,
                 simulated_data[i].name,
                 simulated_data[i].value,
@@ -123,8 +160,8 @@ Item** data_handler_loadItems(DataHandler* handler, int* num_items_loaded) {
                 items_array[current_item_index++] = newItem;
             } else {
                 LOG_WARN("Failed to create Item object for simulated data index %d.", i);
-                // Note: If item_create fails, memory for previous items in items_array is not freed here.
-                // A more robust implementation would clean up already allocated items before returning NULL.
+                // Earlier items stay valid in the slab; they are reclaimed
+                // by the eventual data_handler_releaseItems call.
             }
         } else {
             LOG_WARN("Skipping invalid simulated data dictionary at index %d.", i);
@@ -147,6 +184,275 @@ Item** data_handler_loadItems(DataHandler* handler, int* num_items_loaded) {
     return items_array;
 }
 
+/**
+ * @brief Releases a load returned by data_handler_loadItems.
+ */
+void data_handler_releaseItems(DataHandler* handler, Item*** items_array_ptr) {
+    if (items_array_ptr != NULL && *items_array_ptr != NULL) {
+        free(*items_array_ptr);
+        *items_array_ptr = NULL;
+    }
+    if (handler != NULL) {
+        item_slab_reset(handler->itemSlab);
+    }
+}
+
+// --- Parallel loader with per-thread item pools ---
+
+/**
+ * @struct ItemPool
+ * @brief One loader thread's storage: contiguous items plus a name region.
+ *
+ * Two allocations total, regardless of how many items the thread loads.
+ */
+struct ItemPool {
+    Item* items;          /**< Contiguous array of Item structs. */
+    char* names;          /**< String region holding all item names. */
+    size_t names_used;    /**< Bytes consumed from the name region. */
+    size_t names_capacity; /**< Total bytes in the name region. */
+    int count;            /**< Items placed into the pool so far. */
+    int capacity;         /**< Maximum items the pool can hold. */
+};
+
+/**
+ * @brief Creates a pool sized for a known item range.
+ *
+ * @param item_capacity Maximum number of items the pool will hold.
+ * @param name_bytes Total bytes needed for all names (incl. terminators).
+ * @return ItemPool* The pool, or NULL on allocation failure.
+ */
+static ItemPool* item_pool_create(int item_capacity, size_t name_bytes) {
+    ItemPool* pool = (ItemPool*)malloc(sizeof(ItemPool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->items = (Item*)malloc((size_t)item_capacity * sizeof(Item));
+    pool->names = (char*)malloc(name_bytes > 0 ? name_bytes : 1);
+    if (pool->items == NULL || pool->names == NULL) {
+        free(pool->items);
+        free(pool->names);
+        free(pool);
+        return NULL;
+    }
+    pool->names_used = 0;
+    pool->names_capacity = name_bytes;
+    pool->count = 0;
+    pool->capacity = item_capacity;
+    return pool;
+}
+
+/**
+ * @brief Destroys a pool: two free() calls cover every item and name in it.
+ */
+static void item_pool_destroy(ItemPool** pool_ptr) {
+    if (pool_ptr != NULL && *pool_ptr != NULL) {
+        free((*pool_ptr)->items);
+        free((*pool_ptr)->names);
+        free(*pool_ptr);
+        *pool_ptr = NULL;
+    }
+}
+
+/**
+ * @brief Places one item into the pool, copying its name into the region.
+ *
+ * @return Item* The pooled item, or NULL when the pool is full.
+ */
+static Item* item_pool_add(ItemPool* pool, int id, const char* name, double value) {
+    size_t name_len = strlen(name) + 1; // Including the terminator.
+    if (pool->count >= pool->capacity ||
+        pool->names_used + name_len > pool->names_capacity) {
+        return NULL;
+    }
+
+    char* pooled_name = pool->names + pool->names_used;
+    memcpy(pooled_name, name, name_len);
+    pool->names_used += name_len;
+
+    Item* item = &pool->items[pool->count++];
+    item->itemId = id;
+    item->name = pooled_name;
+    item->value = value;
+    item->processed = false;
+    return item;
+}
+
+/**
+ * @struct LoaderRange
+ * @brief Work description for one loader thread: a record range and its pool.
+ */
+typedef struct {
+    const SimulatedRawItem* data; /**< The full simulated record array. */
+    int begin;                    /**< First record index (inclusive). */
+    int end;                      /**< Last record index (exclusive). */
+    ItemPool* pool;               /**< The thread's private pool. */
+    int skipped;                  /**< Records skipped for missing fields. */
+} LoaderRange;
+
+/**
+ * @brief Thread entry: fill the range's pool from its record partition.
+ *
+ * Touches only thread-local state (its own pool), so no locking is needed.
+ */
+static void* loader_thread_main(void* arg) {
+    LoaderRange* range = (LoaderRange*)arg;
+    for (int i = range->begin; i < range->end; ++i) {
+        const SimulatedRawItem* record = &range->data[i];
+        if (record->has_id && record->has_name && record->has_value) {
+            if (item_pool_add(range->pool, record->item_id, record->name,
+                              record->value) == NULL) {
+                range->skipped++;
+            }
+        } else {
+            range->skipped++;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Load items in parallel using per-thread item pools.
+ */
+ItemLoadResult* data_handler_loadItemsParallel(DataHandler* handler, int num_threads) {
+    if (handler == NULL) {
+        LOG_ERROR("NULL DataHandler passed to data_handler_loadItemsParallel.");
+        return NULL;
+    }
+    if (num_threads < 1) {
+        num_threads = 1;
+    }
+
+    int num_records = 0;
+    const SimulatedRawItem* records = simulated_raw_items(&num_records);
+    if (num_threads > num_records) {
+        num_threads = num_records; // No point in idle loader threads.
+    }
+
+    LOG_INFO("Parallel-loading %d record(s) from %s on %d thread(s)...",
+             num_records, handler->dataSourcePath, num_threads);
+
+    LoaderRange* ranges = (LoaderRange*)calloc((size_t)num_threads, sizeof(LoaderRange));
+    pthread_t* threads = (pthread_t*)malloc((size_t)num_threads * sizeof(pthread_t));
+    ItemLoadResult* result = (ItemLoadResult*)calloc(1, sizeof(ItemLoadResult));
+    if (ranges == NULL || threads == NULL || result == NULL) {
+        LOG_ERROR("Failed to allocate parallel loader bookkeeping.");
+        free(ranges);
+        free(threads);
+        free(result);
+        return NULL;
+    }
+
+    result->pools = (ItemPool**)calloc((size_t)num_threads, sizeof(ItemPool*));
+    if (result->pools == NULL) {
+        LOG_ERROR("Failed to allocate pool array.");
+        free(ranges);
+        free(threads);
+        free(result);
+        return NULL;
+    }
+    result->num_pools = num_threads;
+
+    // Partition the records evenly and size each pool for its range.
+    int per_thread = num_records / num_threads;
+    int remainder = num_records % num_threads;
+    int next_begin = 0;
+    for (int t = 0; t < num_threads; ++t) {
+        int range_size = per_thread + (t < remainder ? 1 : 0);
+        ranges[t].data = records;
+        ranges[t].begin = next_begin;
+        ranges[t].end = next_begin + range_size;
+        next_begin += range_size;
+
+        size_t name_bytes = 0;
+        for (int i = ranges[t].begin; i < ranges[t].end; ++i) {
+            name_bytes += strlen(records[i].name) + 1;
+        }
+        ranges[t].pool = item_pool_create(range_size, name_bytes);
+        if (ranges[t].pool == NULL) {
+            LOG_ERROR("Failed to allocate item pool for loader thread %d.", t);
+            for (int u = 0; u < t; ++u) {
+                item_pool_destroy(&result->pools[u]);
+            }
+            free(result->pools);
+            free(result);
+            free(ranges);
+            free(threads);
+            return NULL;
+        }
+        result->pools[t] = ranges[t].pool;
+    }
+
+    // Run the loader threads and wait for all ranges to complete.
+    for (int t = 0; t < num_threads; ++t) {
+        if (pthread_create(&threads[t], NULL, loader_thread_main, &ranges[t]) != 0) {
+            LOG_WARN("Failed to start loader thread %d; loading its range inline.", t);
+            loader_thread_main(&ranges[t]);
+            threads[t] = pthread_self(); // Marker: nothing to join.
+        }
+    }
+    for (int t = 0; t < num_threads; ++t) {
+        if (!pthread_equal(threads[t], pthread_self())) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+
+    // Stitch the per-pool items into one view, in partition order.
+    int total_items = 0;
+    int total_skipped = 0;
+    for (int t = 0; t < num_threads; ++t) {
+        total_items += ranges[t].pool->count;
+        total_skipped += ranges[t].skipped;
+    }
+    if (total_skipped > 0) {
+        LOG_WARN("Skipped %d invalid record(s) during parallel load.", total_skipped);
+    }
+
+    result->items = (Item**)malloc((size_t)(total_items > 0 ? total_items : 1) * sizeof(Item*));
+    if (result->items == NULL) {
+        LOG_ERROR("Failed to allocate stitched item view.");
+        item_load_result_destroy(&result);
+        free(ranges);
+        free(threads);
+        return NULL;
+    }
+    int next_item = 0;
+    for (int t = 0; t < num_threads; ++t) {
+        for (int i = 0; i < ranges[t].pool->count; ++i) {
+            result->items[next_item++] = &ranges[t].pool->items[i];
+        }
+    }
+    result->num_items = total_items;
+
+    free(ranges);
+    free(threads);
+
+    LOG_INFO("Parallel load finished: %d item(s) in %d pool(s).",
+             result->num_items, result->num_pools);
+    if (result->num_items == 0) {
+        item_load_result_destroy(&result);
+        return NULL;
+    }
+    return result;
+}
+
+/**
+ * @brief Destroys an ItemLoadResult and all pools backing it.
+ */
+void item_load_result_destroy(ItemLoadResult** result_ptr) {
+    if (result_ptr != NULL && *result_ptr != NULL) {
+        ItemLoadResult* result = *result_ptr;
+        if (result->pools != NULL) {
+            for (int t = 0; t < result->num_pools; ++t) {
+                item_pool_destroy(&result->pools[t]);
+            }
+            free(result->pools);
+        }
+        free(result->items);
+        free(result);
+        *result_ptr = NULL;
+    }
+}
+
 /**
  * @brief Simulate saving processed items back to the data source.
  */
@@ -178,4 +484,279 @@ bool data_handler_saveItems(DataHandler* handler, const Item* const* items_array
     return true; // Simulate success
 }
 
+// --- Batched writev save path ---
+
+#ifdef DATA_HANDLER_HAS_WRITEV
+
+// 1 MiB serialization segments, up to 4 per writev: at most one syscall
+// per ~4 MiB of output.
+#define SAVE_SEGMENT_BYTES (1u << 20)
+#define SAVE_SEGMENTS_PER_BATCH 4
+
+/**
+ * @struct SaveWriter
+ * @brief Reusable serialization segments feeding batched writev calls.
+ *
+ * Items are formatted into the current segment; when it fills, the writer
+ * moves to the next one, and once all segments are full (or at the final
+ * flush) the used segments go to the kernel as one writev.
+ */
+typedef struct {
+    int fd;                                   /**< Destination file descriptor. */
+    char* segments[SAVE_SEGMENTS_PER_BATCH];  /**< Serialization buffers. */
+    size_t used[SAVE_SEGMENTS_PER_BATCH];     /**< Bytes filled per segment. */
+    int current;                              /**< Segment currently being filled. */
+} SaveWriter;
+
+/**
+ * @brief Submits every used segment in one writev, handling short writes.
+ *
+ * @return bool True when all buffered bytes reached the descriptor.
+ */
+static bool save_writer_flush(SaveWriter* writer) {
+    struct iovec iov[SAVE_SEGMENTS_PER_BATCH];
+    int iov_count = 0;
+    for (int s = 0; s <= writer->current && s < SAVE_SEGMENTS_PER_BATCH; ++s) {
+        if (writer->used[s] > 0) {
+            iov[iov_count].iov_base = writer->segments[s];
+            iov[iov_count].iov_len = writer->used[s];
+            iov_count++;
+        }
+    }
+
+    int first = 0;
+    while (first < iov_count) {
+        ssize_t written = writev(writer->fd, &iov[first], iov_count - first);
+        if (written < 0) {
+            LOG_ERROR("writev failed during batched save.");
+            return false;
+        }
+        // Consume fully written iovecs, then trim a partially written one.
+        size_t remaining = (size_t)written;
+        while (first < iov_count && remaining >= iov[first].iov_len) {
+            remaining -= iov[first].iov_len;
+            first++;
+        }
+        if (first < iov_count && remaining > 0) {
+            iov[first].iov_base = (char*)iov[first].iov_base + remaining;
+            iov[first].iov_len -= remaining;
+        }
+    }
+
+    for (int s = 0; s < SAVE_SEGMENTS_PER_BATCH; ++s) {
+        writer->used[s] = 0;
+    }
+    writer->current = 0;
+    return true;
+}
+
+/**
+ * @brief Appends @p len bytes, sealing segments and flushing batches as needed.
+ */
+static bool save_writer_append(SaveWriter* writer, const char* bytes, size_t len) {
+    while (len > 0) {
+        if (writer->used[writer->current] == SAVE_SEGMENT_BYTES) {
+            if (writer->current + 1 < SAVE_SEGMENTS_PER_BATCH) {
+                writer->current++;
+            } else if (!save_writer_flush(writer)) {
+                return false;
+            }
+        }
+        size_t space = SAVE_SEGMENT_BYTES - writer->used[writer->current];
+        size_t chunk = len < space ? len : space;
+        memcpy(writer->segments[writer->current] + writer->used[writer->current],
+               bytes, chunk);
+        writer->used[writer->current] += chunk;
+        bytes += chunk;
+        len -= chunk;
+    }
+    return true;
+}
+
+#endif // DATA_HANDLER_HAS_WRITEV
+
+/**
+ * @brief Save items to a real file using large buffers and batched writev.
+ */
+bool data_handler_saveItemsBatched(DataHandler* handler, const char* output_path,
+                                   const Item* const* items_array, int num_items) {
+    if (handler == NULL || output_path == NULL) {
+        LOG_ERROR("NULL parameter passed to data_handler_saveItemsBatched.");
+        return false;
+    }
+    if (items_array == NULL && num_items > 0) {
+        LOG_ERROR("NULL items_array passed to data_handler_saveItemsBatched.");
+        return false;
+    }
+
+#ifdef DATA_HANDLER_HAS_WRITEV
+    SaveWriter writer;
+    writer.fd = open(output_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (writer.fd < 0) {
+        LOG_ERROR("Failed to open '%s' for batched save.", output_path);
+        return false;
+    }
+    writer.current = 0;
+    for (int s = 0; s < SAVE_SEGMENTS_PER_BATCH; ++s) {
+        writer.used[s] = 0;
+        writer.segments[s] = (char*)malloc(SAVE_SEGMENT_BYTES);
+        if (writer.segments[s] == NULL) {
+            LOG_ERROR("Failed to allocate save segment %d.", s);
+            for (int u = 0; u < s; ++u) {
+                free(writer.segments[u]);
+            }
+            close(writer.fd);
+            return false;
+        }
+    }
+
+    LOG_INFO("Batched save of %d items to %s...", num_items, output_path);
+
+    bool ok = true;
+    char line[512];
+    for (int i = 0; ok && i < num_items; ++i) {
+        if (items_array[i] == NULL) {
+            LOG_WARN("Encountered NULL item at index %d during batched save.", i);
+            continue;
+        }
+        int line_len = snprintf(line, sizeof(line), "%d\t%s\t%.2f\t%d\n",
+                                items_array[i]->itemId,
+                                items_array[i]->name != NULL ? items_array[i]->name : "",
+                                items_array[i]->value,
+                                items_array[i]->processed ? 1 : 0);
+        if (line_len < 0 || (size_t)line_len >= sizeof(line)) {
+            LOG_WARN("Item at index %d exceeded the line buffer; truncated.", i);
+            line_len = (int)(sizeof(line) - 1);
+        }
+        ok = save_writer_append(&writer, line, (size_t)line_len);
+    }
+
+    if (ok) {
+        ok = save_writer_flush(&writer);
+    }
+    for (int s = 0; s < SAVE_SEGMENTS_PER_BATCH; ++s) {
+        free(writer.segments[s]);
+    }
+    if (close(writer.fd) != 0) {
+        LOG_ERROR("Failed to close '%s' after batched save.", output_path);
+        return false;
+    }
+
+    if (ok) {
+        LOG_INFO("Batched save finished.");
+    }
+    return ok;
+#else
+    // No writev on this platform: fall back to one buffered stdio stream.
+    FILE* out = fopen(output_path, "w");
+    if (out == NULL) {
+        LOG_ERROR("Failed to open '%s' for save.", output_path);
+        return false;
+    }
+    for (int i = 0; i < num_items; ++i) {
+        if (items_array[i] != NULL) {
+            fprintf(out, "%d\t%s\t%.2f\t%d\n", items_array[i]->itemId,
+                    items_array[i]->name != NULL ? items_array[i]->name : "",
+                    items_array[i]->value, items_array[i]->processed ? 1 : 0);
+        }
+    }
+    bool ok = (fclose(out) == 0);
+    if (ok) {
+        LOG_INFO("Save finished.");
+    }
+    return ok;
+#endif
+}
+
+/**
+ * @brief Export items as a shared-ABI columnar block file.
+ */
+bool data_handler_exportItemsAbi(DataHandler* handler, const char* output_path,
+                                 const Item* const* items_array, int num_items) {
+    if (handler == NULL || output_path == NULL) {
+        LOG_ERROR("NULL parameter passed to data_handler_exportItemsAbi.");
+        return false;
+    }
+    if (items_array == NULL && num_items > 0) {
+        LOG_ERROR("NULL items_array passed to data_handler_exportItemsAbi.");
+        return false;
+    }
+
+    // First pass: count exportable items and total name bytes so the whole
+    // block can be laid out in one allocation.
+    uint64_t item_count = 0;
+    uint64_t name_bytes = 0;
+    for (int i = 0; i < num_items; ++i) {
+        if (items_array[i] == NULL) {
+            LOG_WARN("Encountered NULL item at index %d during ABI export.", i);
+            continue;
+        }
+        ++item_count;
+        if (items_array[i]->name != NULL) {
+            name_bytes += strlen(items_array[i]->name);
+        }
+    }
+
+    size_t block_bytes = item_batch_abi_blockBytes(item_count, name_bytes);
+    char* block = (char*)malloc(block_bytes);
+    if (block == NULL) {
+        LOG_ERROR("Failed to allocate %zu-byte ABI export block.", block_bytes);
+        return false;
+    }
+
+    ItemBatchAbiHeader* header = (ItemBatchAbiHeader*)block;
+    item_batch_abi_initHeader(header, item_count, name_bytes);
+
+    // Second pass: fill the columns. The consumer reads these arrays as-is —
+    // no per-item text formatting on this side, no re-parsing on the other.
+    int32_t* ids = (int32_t*)(block + header->ids_offset);
+    double* values = (double*)(block + header->values_offset);
+    uint8_t* processed = (uint8_t*)(block + header->processed_offset);
+    uint64_t* name_offsets = (uint64_t*)(block + header->name_offsets_offset);
+    uint32_t* name_lengths = (uint32_t*)(block + header->name_lengths_offset);
+    char* names = block + item_batch_abi_namesOffset(header);
+
+    uint64_t row = 0;
+    uint64_t name_cursor = 0;
+    for (int i = 0; i < num_items; ++i) {
+        const Item* item = items_array[i];
+        if (item == NULL) {
+            continue;
+        }
+        size_t name_len = item->name != NULL ? strlen(item->name) : 0;
+        ids[row] = (int32_t)item->itemId;
+        values[row] = item->value;
+        processed[row] = item->processed ? 1 : 0;
+        name_offsets[row] = name_cursor;
+        name_lengths[row] = (uint32_t)name_len;
+        if (name_len > 0) {
+            memcpy(names + name_cursor, item->name, name_len);
+        }
+        name_cursor += name_len;
+        ++row;
+    }
+
+    LOG_INFO("Exporting %d item(s) as ABI batch block to %s (%zu bytes)...",
+             (int)item_count, output_path, block_bytes);
+
+    FILE* out = fopen(output_path, "wb");
+    if (out == NULL) {
+        LOG_ERROR("Failed to open '%s' for ABI export.", output_path);
+        free(block);
+        return false;
+    }
+    bool ok = fwrite(block, 1, block_bytes, out) == block_bytes;
+    if (fclose(out) != 0) {
+        ok = false;
+    }
+    free(block);
+
+    if (ok) {
+        LOG_INFO("ABI export finished.");
+    } else {
+        LOG_ERROR("ABI export to '%s' failed.", output_path);
+    }
+    return ok;
+}
+
 // End of c_sample_project/src/data_handler.c
\ No newline at end of file
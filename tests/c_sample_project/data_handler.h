@@ -6,7 +6,8 @@
 #include <stdbool.h> // For bool
 #include <stddef.h>  // For size_t
 
-#include "item.h"    // Definition of the Item struct
+#include "item.h"      // Definition of the Item struct
+#include "item_slab.h" // Slab allocator backing loaded items
 
 /**
  * @struct DataHandler
@@ -17,6 +18,7 @@
  */
 typedef struct {
     char* dataSourcePath; /**< The configured path to the data source (dynamically allocated). */
+    ItemSlabAllocator* itemSlab; /**< Slab allocator owning all items returned by loadItems. */
     // In a real application, you might add more state here,
     // e.g., a file pointer if the file is kept open, or a logger instance.
 } DataHandler;
@@ -51,14 +53,86 @@ void data_handler_destroy(DataHandler** handler_ptr);
  * The caller is responsible for freeing the memory allocated for the items array
  * and each Item within it (e.g., by iterating and calling item_destroy).
  *
+ * Items are placed in the handler's slab allocator, not malloc'd
+ * individually: release a finished load with data_handler_releaseItems()
+ * instead of calling item_destroy() per item.
+ *
  * @param handler Pointer to the DataHandler instance.
  * @param num_items_loaded Pointer to an integer where the number of loaded items will be stored.
- * @return Item** A dynamically allocated array of pointers to Item objects,
- *                or NULL if an error occurs or no items are loaded.
- *                The array itself and each Item* in it must be freed by the caller.
+ * @return Item** A dynamically allocated array of pointers to slab-resident
+ *                Item objects, or NULL if an error occurs or no items are
+ *                loaded. Free via data_handler_releaseItems().
  */
 Item** data_handler_loadItems(DataHandler* handler, int* num_items_loaded);
 
+/**
+ * @brief Releases a load returned by data_handler_loadItems.
+ *
+ * Frees the pointer array and resets the handler's slab allocator, which
+ * reclaims every item and name in constant time per slab (the slabs stay
+ * allocated for the next load). Sets the array pointer to NULL.
+ *
+ * @param handler Pointer to the DataHandler instance the items came from.
+ * @param items_array_ptr Pointer to the pointer array to release.
+ */
+void data_handler_releaseItems(DataHandler* handler, Item*** items_array_ptr);
+
+/**
+ * @struct ItemPool
+ * @brief Opaque per-thread item pool used by the parallel loader.
+ *
+ * Each pool is a single large allocation holding its items contiguously
+ * plus one string region for all of their names, so a load performs a
+ * couple of mallocs per loader thread instead of three per item.
+ * Defined in data_handler.c.
+ */
+typedef struct ItemPool ItemPool;
+
+/**
+ * @struct ItemLoadResult
+ * @brief Result of a parallel load: a stitched item view plus the pools
+ *        that own the storage.
+ *
+ * The items array points into the pools; individual items must NOT be
+ * passed to item_destroy(). Free the whole result with
+ * item_load_result_destroy(), which tears down every pool in a constant
+ * number of free() calls.
+ */
+typedef struct {
+    Item** items;    /**< Stitched array of item pointers (views into the pools). */
+    int num_items;   /**< Number of entries in items. */
+    ItemPool** pools; /**< One pool per loader thread. */
+    int num_pools;   /**< Number of entries in pools. */
+} ItemLoadResult;
+
+/**
+ * @brief Load items in parallel using per-thread item pools.
+ *
+ * The input record range is partitioned across num_threads loader threads;
+ * each thread fills its own thread-local pool (one allocation for the Item
+ * structs, one for the names), and the per-thread results are stitched into
+ * a single items view at the end. Behaves like data_handler_loadItems for
+ * validation: records missing required fields are skipped with a warning.
+ *
+ * @param handler Pointer to the DataHandler instance.
+ * @param num_threads Number of loader threads (values < 1 are clamped to 1).
+ * @return ItemLoadResult* The loaded items and their owning pools, or NULL
+ *                         on allocation failure or when nothing was loaded.
+ *                         Free with item_load_result_destroy().
+ */
+ItemLoadResult* data_handler_loadItemsParallel(DataHandler* handler, int num_threads);
+
+/**
+ * @brief Destroys an ItemLoadResult and all pools backing it.
+ *
+ * Frees the stitched view, each pool's two allocations and the result
+ * structure itself; teardown cost is proportional to the number of loader
+ * threads, not the number of items. Sets the pointer to NULL.
+ *
+ * @param result_ptr Pointer to the pointer of the result to destroy.
+ */
+void item_load_result_destroy(ItemLoadResult** result_ptr);
+
 /**
  * @brief Simulate saving processed items back to the data source.
  *
@@ -72,5 +146,43 @@ Item** data_handler_loadItems(DataHandler* handler, int* num_items_loaded);
  */
 bool data_handler_saveItems(DataHandler* handler, const Item* const* items_array, int num_items);
 
+/**
+ * @brief Save items to a real file using large buffers and batched writev.
+ *
+ * High-throughput counterpart of data_handler_saveItems: items are
+ * serialized as tab-separated lines into reusable 1 MiB segments, and full
+ * segments are submitted to the kernel in writev batches — one syscall per
+ * few megabytes instead of one stdio write per item, which is what lets the
+ * save path approach the disk's sequential bandwidth. On platforms without
+ * writev the segments are flushed with plain write() one at a time.
+ *
+ * @param handler Pointer to the DataHandler instance (used for logging context).
+ * @param output_path Path of the file to (over)write.
+ * @param items_array An array of pointers to Item objects to save.
+ * @param num_items The number of items in the items_array.
+ * @return bool True if every item was written and the file closed cleanly.
+ */
+bool data_handler_saveItemsBatched(DataHandler* handler, const char* output_path,
+                                   const Item* const* items_array, int num_items);
+
+/**
+ * @brief Export items as a shared-ABI columnar block for the C++ host.
+ *
+ * Writes the batch in the layout defined by item_batch_abi.h: a fixed
+ * header followed by dense id/value/processed columns and one name blob.
+ * The aggregation host maps the block and reads the columns directly —
+ * no JSON serialization here and no re-parsing there, which removes the
+ * formatting hop from the edge-to-host path entirely. NULL entries in
+ * items_array are skipped with a warning, like the other save paths.
+ *
+ * @param handler Pointer to the DataHandler instance (used for logging context).
+ * @param output_path Path of the block file to (over)write.
+ * @param items_array An array of pointers to Item objects to export.
+ * @param num_items The number of items in the items_array.
+ * @return bool True if the whole block was written and closed cleanly.
+ */
+bool data_handler_exportItemsAbi(DataHandler* handler, const char* output_path,
+                                 const Item* const* items_array, int num_items);
+
 #endif // DATA_HANDLER_H
 // End of c_sample_project/include/data_handler.h
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "item_processor.h"
 #include <stdio.h>  // For printf (used for logging/debug)
 #include <stdlib.h> // For malloc, free
+#include <string.h> // For strlen, strcpy, strncpy, strcat
 
 // Helper for logging (simplistic) - copied from data_handler.c for standalone use
 // In a real application, this would be in a shared utility module.
@@ -103,4 +104,51 @@ bool item_processor_processItem(ItemProcessor* processor, Item* item) {
     return true;
 }
 
+/**
+ * @brief Process a whole batch of items in one tight loop.
+ */
+size_t item_processor_processBatch(ItemProcessor* processor, Item** items_array,
+                                   size_t num_items, uint8_t* above_mask) {
+    if (processor == NULL) {
+        LOG_ERROR_IP("NULL processor passed to item_processor_processBatch.");
+        return 0;
+    }
+    if (items_array == NULL && num_items > 0) {
+        LOG_ERROR_IP("NULL items_array passed to item_processor_processBatch.");
+        return 0;
+    }
+
+    // Validated once above; from here the loop carries no error paths.
+    const double threshold = (double)processor->threshold;
+    size_t above_count = 0;
+    size_t null_items = 0;
+
+    for (size_t i = 0; i < num_items; ++i) {
+        Item* item = items_array[i];
+        if (item == NULL) {
+            ++null_items;
+            if (above_mask != NULL) {
+                above_mask[i] = 0;
+            }
+            continue;
+        }
+        // Branch-free outcome: the comparison result is used as a 0/1 value
+        // rather than selecting a code path, so the loop stays predictable
+        // regardless of how values are distributed around the threshold.
+        uint8_t above = (uint8_t)(item->value > threshold);
+        above_count += above;
+        if (above_mask != NULL) {
+            above_mask[i] = above;
+        }
+        item->processed = true;
+    }
+
+    if (null_items > 0) {
+        LOG_WARN_IP("Skipped %zu NULL item(s) in batch of %zu.", null_items, num_items);
+    }
+    LOG_INFO_IP("Batch processed: %zu item(s), %zu above threshold %d.",
+                num_items - null_items, above_count, processor->threshold);
+    return above_count;
+}
+
 // End of c_sample_project/src/item_processor.c
\ No newline at end of file
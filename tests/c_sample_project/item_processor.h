@@ -4,6 +4,8 @@
 #define ITEM_PROCESSOR_H
 
 #include <stdbool.h> // For bool
+#include <stddef.h>  // For size_t
+#include <stdint.h>  // For uint8_t
 #include "item.h"    // Definition of the Item struct
 
 /**
@@ -54,5 +56,26 @@ void item_processor_destroy(ItemProcessor** processor_ptr);
  */
 bool item_processor_processItem(ItemProcessor* processor, Item* item);
 
+/**
+ * @brief Process a whole batch of items in one tight loop.
+ *
+ * Batch counterpart of item_processor_processItem: arguments are validated
+ * once, the threshold is hoisted into a local, and the loop marks each item
+ * processed while recording its above/below outcome branch-free into
+ * @p above_mask (one byte per item, 1 when value > threshold). NULL entries
+ * are tolerated (their mask byte stays 0) without a separate branch on the
+ * happy path. Only a per-batch summary is logged — no per-item stdio calls,
+ * which is where the single-item path spends nearly all of its time.
+ *
+ * @param processor Pointer to the ItemProcessor instance containing the threshold.
+ * @param items_array Array of pointers to the items to process (modified in place).
+ * @param num_items Number of entries in items_array.
+ * @param above_mask Output array of num_items bytes receiving the mask.
+ *                   May be NULL when the caller only needs the count.
+ * @return size_t The number of items whose value exceeds the threshold.
+ */
+size_t item_processor_processBatch(ItemProcessor* processor, Item** items_array,
+                                   size_t num_items, uint8_t* above_mask);
+
 #endif // ITEM_PROCESSOR_H
 // End of c_sample_project/include/item_processor.h
\ No newline at end of file
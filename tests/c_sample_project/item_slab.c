@@ -0,0 +1,186 @@
+// c_sample_project/src/item_slab.c
+
+#include "item_slab.h" // Corresponding header file
+#include <stdlib.h>    // For malloc, free
+#include <string.h>    // For memcpy, strlen
+
+// Defaults used when item_slab_create is called with non-positive sizes.
+#define ITEM_SLAB_DEFAULT_ITEMS 1024
+#define ITEM_SLAB_DEFAULT_STRING_BYTES (32 * 1024)
+
+/**
+ * @struct ItemSlab
+ * @brief One slab: a contiguous run of Items plus a string region.
+ */
+typedef struct ItemSlab {
+    struct ItemSlab* next;  /**< Next slab in the allocator's list. */
+    Item* items;            /**< Contiguous Item storage. */
+    char* strings;          /**< Name storage for items of this slab. */
+    size_t strings_used;    /**< Bytes consumed from strings. */
+    size_t strings_capacity; /**< Total bytes in strings. */
+    int used;               /**< Items bump-allocated from this slab. */
+    int capacity;           /**< Total items in this slab. */
+} ItemSlab;
+
+/**
+ * @struct FreeNode
+ * @brief Intrusive freelist node, stored inside a returned Item's memory.
+ */
+typedef struct FreeNode {
+    struct FreeNode* next; /**< Next recycled item. */
+} FreeNode;
+
+struct ItemSlabAllocator {
+    ItemSlab* slabs;        /**< All slabs, most recent first. */
+    FreeNode* free_list;    /**< Recycled items awaiting reuse. */
+    int items_per_slab;     /**< Items per newly created slab. */
+    size_t string_bytes_per_slab; /**< Name bytes per newly created slab. */
+};
+
+/**
+ * @brief Allocates one new slab and links it at the head of the list.
+ */
+static ItemSlab* item_slab_add_slab(ItemSlabAllocator* allocator) {
+    ItemSlab* slab = (ItemSlab*)malloc(sizeof(ItemSlab));
+    if (slab == NULL) {
+        return NULL;
+    }
+    slab->items = (Item*)malloc((size_t)allocator->items_per_slab * sizeof(Item));
+    slab->strings = (char*)malloc(allocator->string_bytes_per_slab);
+    if (slab->items == NULL || slab->strings == NULL) {
+        free(slab->items);
+        free(slab->strings);
+        free(slab);
+        return NULL;
+    }
+    slab->strings_used = 0;
+    slab->strings_capacity = allocator->string_bytes_per_slab;
+    slab->used = 0;
+    slab->capacity = allocator->items_per_slab;
+    slab->next = allocator->slabs;
+    allocator->slabs = slab;
+    return slab;
+}
+
+/**
+ * @brief Copies a name into a slab string region, adding a slab if needed.
+ *
+ * @return char* The slab-resident copy, or NULL on allocation failure.
+ */
+static char* item_slab_copy_name(ItemSlabAllocator* allocator, const char* name) {
+    size_t name_len = strlen(name) + 1; // Including the terminator.
+
+    ItemSlab* slab = allocator->slabs;
+    if (slab == NULL || slab->strings_used + name_len > slab->strings_capacity) {
+        // Oversized names get their dedicated capacity honored by growing
+        // the per-slab region request for this one slab.
+        size_t saved_bytes = allocator->string_bytes_per_slab;
+        if (name_len > saved_bytes) {
+            allocator->string_bytes_per_slab = name_len;
+        }
+        slab = item_slab_add_slab(allocator);
+        allocator->string_bytes_per_slab = saved_bytes;
+        if (slab == NULL) {
+            return NULL;
+        }
+    }
+
+    char* copy = slab->strings + slab->strings_used;
+    memcpy(copy, name, name_len);
+    slab->strings_used += name_len;
+    return copy;
+}
+
+ItemSlabAllocator* item_slab_create(int items_per_slab, size_t string_bytes_per_slab) {
+    ItemSlabAllocator* allocator = (ItemSlabAllocator*)malloc(sizeof(ItemSlabAllocator));
+    if (allocator == NULL) {
+        return NULL;
+    }
+    allocator->slabs = NULL;
+    allocator->free_list = NULL;
+    allocator->items_per_slab =
+        items_per_slab >= 1 ? items_per_slab : ITEM_SLAB_DEFAULT_ITEMS;
+    allocator->string_bytes_per_slab =
+        string_bytes_per_slab > 0 ? string_bytes_per_slab : ITEM_SLAB_DEFAULT_STRING_BYTES;
+    return allocator;
+}
+
+void item_slab_destroy(ItemSlabAllocator** allocator_ptr) {
+    if (allocator_ptr != NULL && *allocator_ptr != NULL) {
+        ItemSlab* slab = (*allocator_ptr)->slabs;
+        while (slab != NULL) {
+            ItemSlab* next = slab->next;
+            free(slab->items);
+            free(slab->strings);
+            free(slab);
+            slab = next;
+        }
+        free(*allocator_ptr);
+        *allocator_ptr = NULL;
+    }
+}
+
+Item* item_slab_alloc(ItemSlabAllocator* allocator, int id, const char* itemName,
+                      double itemValue, bool isProcessed) {
+    if (allocator == NULL || itemName == NULL) {
+        return NULL;
+    }
+
+    // Prefer a recycled item from the intrusive freelist.
+    Item* item = NULL;
+    if (allocator->free_list != NULL) {
+        item = (Item*)allocator->free_list;
+        allocator->free_list = allocator->free_list->next;
+    } else {
+        ItemSlab* slab = allocator->slabs;
+        if (slab == NULL || slab->used >= slab->capacity) {
+            slab = item_slab_add_slab(allocator);
+            if (slab == NULL) {
+                return NULL;
+            }
+        }
+        item = &slab->items[slab->used++];
+    }
+
+    char* pooled_name = item_slab_copy_name(allocator, itemName);
+    if (pooled_name == NULL) {
+        // Put the struct back so it is not leaked from the slab's view.
+        FreeNode* node = (FreeNode*)item;
+        node->next = allocator->free_list;
+        allocator->free_list = node;
+        return NULL;
+    }
+
+    item->itemId = id;
+    item->name = pooled_name;
+    item->value = itemValue;
+    item->processed = isProcessed;
+    return item;
+}
+
+void item_slab_free(ItemSlabAllocator* allocator, Item** item_ptr) {
+    if (allocator == NULL || item_ptr == NULL || *item_ptr == NULL) {
+        return;
+    }
+    // Thread the freelist through the item's own memory; the name bytes
+    // stay in their slab until the next reset.
+    FreeNode* node = (FreeNode*)(*item_ptr);
+    node->next = allocator->free_list;
+    allocator->free_list = node;
+    *item_ptr = NULL;
+}
+
+void item_slab_reset(ItemSlabAllocator* allocator) {
+    if (allocator == NULL) {
+        return;
+    }
+    // One pass over the slab list: every item and every name is reclaimed
+    // without a single free() call, and the slabs stay warm for reuse.
+    for (ItemSlab* slab = allocator->slabs; slab != NULL; slab = slab->next) {
+        slab->used = 0;
+        slab->strings_used = 0;
+    }
+    allocator->free_list = NULL;
+}
+
+// End of c_sample_project/src/item_slab.c
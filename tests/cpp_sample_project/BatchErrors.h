@@ -0,0 +1,149 @@
+// cpp_sample_project/include/BatchErrors.h
+
+#ifndef BATCH_ERRORS_H
+#define BATCH_ERRORS_H
+
+#include <cstdint>  // For the compact error code and bitmap words
+#include <iostream> // For the failure summary report
+#include <vector>   // For the bitmap and failure list
+
+/**
+ * @brief Per-record error codes for the non-throwing load path.
+ *
+ * One byte each, so a batch's failure record stays compact; the codes cover
+ * the ways a source record can be rejected without the loader ever throwing.
+ * Truly fatal conditions — an unreadable file, a corrupt mapping — remain
+ * exceptions; these codes are for the expected sub-0.1% of bad records that
+ * must not cost the other 99.9% their vectorized loop.
+ */
+enum class ItemError : std::uint8_t {
+    None = 0,        /**< Record loaded successfully. */
+    MissingId,       /**< Required "item_id" key absent. */
+    MissingName,     /**< Required "name" key absent. */
+    MissingValue,    /**< Required "value" key absent. */
+    BadIdType,       /**< "item_id" present but not an integer. */
+    BadNameType,     /**< "name" present but not a string. */
+    BadValueType,    /**< "value" present but not a number. */
+};
+
+/**
+ * @brief Human-readable name of an ItemError code.
+ */
+inline const char* itemErrorName(ItemError code) {
+    switch (code) {
+        case ItemError::None:         return "none";
+        case ItemError::MissingId:    return "missing item_id";
+        case ItemError::MissingName:  return "missing name";
+        case ItemError::MissingValue: return "missing value";
+        case ItemError::BadIdType:    return "item_id has wrong type";
+        case ItemError::BadNameType:  return "name has wrong type";
+        case ItemError::BadValueType: return "value has wrong type";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Per-batch failure record: a bitmap plus a compact error list.
+ *
+ * Replaces the per-item try/catch frames (and the old habit of copying each
+ * failed Item into a side vector) on the load path. Success costs nothing —
+ * no bit is set, no entry is appended, no exception machinery sits inside
+ * the parse loop to inhibit vectorization. A failure sets one bit, keyed by
+ * source-record position, and appends a 5-byte (record, code) entry; at our
+ * failure rates the whole structure is a few cache lines regardless of
+ * batch size.
+ *
+ * Record positions refer to the source record stream (including rejected
+ * records), not to positions in the resulting batch, so a failure can be
+ * traced back to its line in the input.
+ */
+class BatchFailures {
+public:
+    /** @brief One recorded failure: source record position plus its code. */
+    struct Failure {
+        std::uint32_t record; /**< Position in the source record stream. */
+        ItemError code;       /**< Why the record was rejected. */
+    };
+
+    /**
+     * @brief Marks the record at @p record as failed with @p code.
+     *
+     * @param record Position of the record in the source stream.
+     * @param code The rejection reason.
+     */
+    void recordFailure(std::size_t record, ItemError code) {
+        std::size_t word = record / 64;
+        if (word >= bitmap_.size()) {
+            bitmap_.resize(word + 1, 0);
+        }
+        bitmap_[word] |= std::uint64_t{1} << (record % 64);
+        failures_.push_back({static_cast<std::uint32_t>(record), code});
+    }
+
+    /**
+     * @brief Returns true if the record at @p record was marked failed.
+     */
+    bool failed(std::size_t record) const {
+        std::size_t word = record / 64;
+        return word < bitmap_.size() &&
+               (bitmap_[word] >> (record % 64) & 1) != 0;
+    }
+
+    /**
+     * @brief Number of failures recorded.
+     */
+    std::size_t failureCount() const { return failures_.size(); }
+
+    /**
+     * @brief Returns true when no failures were recorded.
+     */
+    bool empty() const { return failures_.empty(); }
+
+    /**
+     * @brief The compact failure list, in source-record order.
+     */
+    const std::vector<Failure>& failures() const { return failures_; }
+
+    /**
+     * @brief Forgets all recorded failures.
+     */
+    void clear() {
+        bitmap_.clear();
+        failures_.clear();
+    }
+
+    /**
+     * @brief Writes a short failure summary to @p out.
+     *
+     * One line per failure up to @p maxDetailed, then a count of the rest —
+     * a million-record batch with a bad shard should not produce a million
+     * warning lines.
+     *
+     * @param out Stream receiving the summary.
+     * @param maxDetailed Maximum individual failures to list (default 5).
+     */
+    void report(std::ostream& out, std::size_t maxDetailed = 5) const {
+        if (failures_.empty()) {
+            return;
+        }
+        out << "WARNING: " << failures_.size() << " record(s) rejected during load:" << std::endl;
+        std::size_t listed = 0;
+        for (const Failure& failure : failures_) {
+            if (listed == maxDetailed) {
+                out << "WARNING:   ... and " << (failures_.size() - listed)
+                    << " more." << std::endl;
+                break;
+            }
+            out << "WARNING:   record " << failure.record << ": "
+                << itemErrorName(failure.code) << std::endl;
+            ++listed;
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> bitmap_; /**< One bit per source record, set on failure. */
+    std::vector<Failure> failures_;     /**< Compact (record, code) list, in order. */
+};
+
+#endif // BATCH_ERRORS_H
+// End of cpp_sample_project/include/BatchErrors.h
@@ -0,0 +1,97 @@
+// cpp_sample_project/include/BoundedQueue.h
+
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable> // For blocking push/pop
+#include <cstddef>            // For std::size_t
+#include <deque>              // For the underlying buffer
+#include <mutex>              // For queue locking
+#include <utility>            // For std::move
+
+/**
+ * @brief Bounded multi-producer/multi-consumer queue for pipeline stages.
+ *
+ * push() blocks while the queue is full and pop() blocks while it is empty,
+ * which is exactly the backpressure the pipelined load -> process -> save
+ * mode needs: a fast loader cannot run ahead of the processors by more than
+ * the queue capacity, so peak memory stays at a few chunks instead of the
+ * whole dataset. close() wakes all waiters; consumers drain the remaining
+ * elements and then see pop() return false.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * @brief Constructs a queue holding at most @p capacity elements.
+     *
+     * @param capacity Maximum number of buffered elements (must be >= 1).
+     */
+    explicit BoundedQueue(std::size_t capacity)
+        : capacity_(capacity != 0 ? capacity : 1) {
+    }
+
+    /**
+     * @brief Enqueues a value, blocking while the queue is full.
+     *
+     * @param value The value to enqueue (moved in).
+     * @return bool False if the queue was closed before the value could be
+     *              enqueued, true otherwise.
+     */
+    bool push(T value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this]() { return buffer_.size() < capacity_ || closed_; });
+        if (closed_) {
+            return false;
+        }
+        buffer_.push_back(std::move(value));
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Dequeues a value, blocking while the queue is empty.
+     *
+     * @param out Receives the dequeued value on success.
+     * @return bool False once the queue is closed and fully drained,
+     *              true when a value was produced.
+     */
+    bool pop(T& out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this]() { return !buffer_.empty() || closed_; });
+        if (buffer_.empty()) {
+            return false; // Closed and drained.
+        }
+        out = std::move(buffer_.front());
+        buffer_.pop_front();
+        lock.unlock();
+        notFull_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Marks the queue closed and wakes all blocked producers/consumers.
+     *
+     * Elements already enqueued remain poppable; further pushes fail.
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        notFull_.notify_all();
+        notEmpty_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;                  /**< Guards buffer_ and closed_. */
+    std::condition_variable notFull_;   /**< Signaled when space frees up. */
+    std::condition_variable notEmpty_;  /**< Signaled when an element arrives. */
+    std::deque<T> buffer_;              /**< The bounded element buffer. */
+    std::size_t capacity_;              /**< Maximum buffered elements. */
+    bool closed_ = false;               /**< Set once no more pushes will come. */
+};
+
+#endif // BOUNDED_QUEUE_H
+// End of cpp_sample_project/include/BoundedQueue.h
@@ -0,0 +1,235 @@
+// cpp_sample_project/include/Checkpoint.h
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>  // For the fixed-width header fields
+#include <cstring>  // For std::memcpy
+#include <iostream> // For checkpoint notices
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>    // For open
+#include <sys/mman.h> // For mmap/msync/munmap
+#include <sys/stat.h> // For fstat
+#include <unistd.h>   // For close, ftruncate
+#define CHECKPOINT_HAS_MMAP 1
+#endif
+
+#include "ItemBatch.h" // Restored-into / recorded-from batch store
+
+/**
+ * @brief Memory-mapped snapshot of a batch's processing state.
+ *
+ * Persists the processed-flag column plus a resume cursor in a small mapped
+ * file: marking an item done is a one-byte store into the mapping, and
+ * durability points are explicit msync() calls at whatever cadence the
+ * pipeline chooses — no write syscalls on the per-item path. After a
+ * preemption the next run opens the same file, finds a matching item count,
+ * and restores the flags into the freshly loaded batch; work already done
+ * is skipped, so a restart costs a load plus a flag copy instead of a full
+ * re-process of millions of items.
+ *
+ * File layout: magic, version, item count, cursor (24-byte header), then
+ * one flag byte per item. A file whose magic/version/count do not match the
+ * current run is reinitialized — a changed input invalidates old progress.
+ * On platforms without mmap open() reports failure and the pipeline simply
+ * runs uncheckpointed.
+ */
+class ProcessingCheckpoint {
+public:
+    /** @brief Identifies processing-checkpoint files ("SLCP"). */
+    static constexpr std::uint32_t kMagic = 0x50434C53;
+    /** @brief Bumped when the on-disk layout changes. */
+    static constexpr std::uint32_t kFormatVersion = 1;
+
+    ProcessingCheckpoint() = default;
+    ProcessingCheckpoint(const ProcessingCheckpoint&) = delete;
+    ProcessingCheckpoint& operator=(const ProcessingCheckpoint&) = delete;
+
+    ~ProcessingCheckpoint() { close(); }
+
+    /**
+     * @brief Opens (or creates) the checkpoint file for @p itemCount items.
+     *
+     * An existing file with a matching header keeps its recorded progress;
+     * anything else — missing file, stale layout, different item count — is
+     * initialized to an empty snapshot.
+     *
+     * @param path The checkpoint file path.
+     * @param itemCount Number of items in the batch being checkpointed.
+     * @return bool True when the mapping is ready; false when the file
+     *              cannot be created or the platform lacks mmap.
+     */
+    bool open(const std::string& path, std::uint64_t itemCount) {
+#ifdef CHECKPOINT_HAS_MMAP
+        close();
+        const std::size_t fileBytes = kHeaderBytes + static_cast<std::size_t>(itemCount);
+
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) {
+            return false;
+        }
+
+        struct stat st {};
+        bool reuse = false;
+        if (fstat(fd_, &st) == 0 && static_cast<std::size_t>(st.st_size) == fileBytes) {
+            // Candidate for resume; validated against the header below.
+            reuse = true;
+        } else if (ftruncate(fd_, static_cast<off_t>(fileBytes)) != 0) {
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+
+        void* base = mmap(nullptr, fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+        data_ = static_cast<char*>(base);
+        mappedBytes_ = fileBytes;
+        itemCount_ = itemCount;
+
+        Header header {};
+        std::memcpy(&header, data_, sizeof(header));
+        if (!reuse || header.magic != kMagic || header.version != kFormatVersion ||
+            header.itemCount != itemCount) {
+            // Fresh (or invalidated) snapshot: zero the flags and header.
+            header.magic = kMagic;
+            header.version = kFormatVersion;
+            header.itemCount = itemCount;
+            header.cursor = 0;
+            std::memcpy(data_, &header, sizeof(header));
+            std::memset(flags(), 0, static_cast<std::size_t>(itemCount));
+        }
+        return true;
+#else
+        (void)path;
+        (void)itemCount;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief True when a mapping is active.
+     */
+    bool isOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief The resume cursor: items before it are known fully processed.
+     */
+    std::uint64_t cursor() const { return isOpen() ? header().cursor : 0; }
+
+    /**
+     * @brief Advances the resume cursor (one store into the mapping).
+     */
+    void setCursor(std::uint64_t cursor) {
+        if (isOpen()) {
+            header().cursor = cursor;
+        }
+    }
+
+    /**
+     * @brief Marks one item processed in the snapshot.
+     */
+    void markProcessed(std::uint64_t index) {
+        if (isOpen() && index < itemCount_) {
+            flags()[index] = 1;
+        }
+    }
+
+    /**
+     * @brief Copies the batch's processed flags into the snapshot.
+     *
+     * Called after a processing pass (or periodically between chunks),
+     * typically followed by sync() to make the progress durable.
+     *
+     * @param batch The batch whose flags to record.
+     */
+    void recordFrom(const ItemBatch& batch) {
+        if (!isOpen() || batch.size() != itemCount_) {
+            return;
+        }
+        std::memcpy(flags(), batch.processedFlags().data(),
+                    static_cast<std::size_t>(itemCount_));
+    }
+
+    /**
+     * @brief Applies the snapshot's flags to a freshly loaded batch.
+     *
+     * @param batch The batch to pre-mark; must match the snapshot's size.
+     * @return std::size_t Number of items restored as already processed.
+     */
+    std::size_t restoreInto(ItemBatch& batch) {
+        if (!isOpen() || batch.size() != itemCount_) {
+            return 0;
+        }
+        std::size_t restored = 0;
+        const std::uint8_t* snapshotFlags = flags();
+        for (std::uint64_t i = 0; i < itemCount_; ++i) {
+            if (snapshotFlags[i] != 0) {
+                batch.markProcessed(static_cast<std::size_t>(i));
+                ++restored;
+            }
+        }
+        return restored;
+    }
+
+    /**
+     * @brief Flushes the mapping to disk (the durability point).
+     *
+     * @return bool True if msync succeeded.
+     */
+    bool sync() {
+#ifdef CHECKPOINT_HAS_MMAP
+        return isOpen() && msync(data_, mappedBytes_, MS_SYNC) == 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Unmaps and closes the snapshot file.
+     */
+    void close() {
+#ifdef CHECKPOINT_HAS_MMAP
+        if (data_ != nullptr) {
+            munmap(data_, mappedBytes_);
+            data_ = nullptr;
+            mappedBytes_ = 0;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        itemCount_ = 0;
+    }
+
+private:
+    /** @brief The snapshot file's fixed-size header. */
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint64_t itemCount;
+        std::uint64_t cursor;
+    };
+    static constexpr std::size_t kHeaderBytes = sizeof(Header);
+
+    Header& header() { return *reinterpret_cast<Header*>(data_); }
+    const Header& header() const { return *reinterpret_cast<const Header*>(data_); }
+    std::uint8_t* flags() { return reinterpret_cast<std::uint8_t*>(data_ + kHeaderBytes); }
+    const std::uint8_t* flags() const {
+        return reinterpret_cast<const std::uint8_t*>(data_ + kHeaderBytes);
+    }
+
+    char* data_ = nullptr;         /**< Base of the mapping. */
+    std::size_t mappedBytes_ = 0;  /**< Length of the mapping. */
+    std::uint64_t itemCount_ = 0;  /**< Items covered by the snapshot. */
+    int fd_ = -1;                  /**< Underlying file descriptor. */
+};
+
+#endif // CHECKPOINT_H
+// End of cpp_sample_project/include/Checkpoint.h
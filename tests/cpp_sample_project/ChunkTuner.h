@@ -0,0 +1,213 @@
+// cpp_sample_project/include/ChunkTuner.h
+
+#ifndef CHUNK_TUNER_H
+#define CHUNK_TUNER_H
+
+#include <atomic>   // For the lock-free chunk-size read on the hot path
+#include <cstdint>  // For nanosecond accounting
+#include <iostream> // For the tuning report
+#include <mutex>    // For the (cold) trial bookkeeping
+
+/**
+ * @brief Online chunk-size autotuner for the parallel pipeline stages.
+ *
+ * The right chunk size differs wildly between hosts — NVMe boxes want big
+ * chunks that amortize queue traffic, network-storage hosts want small ones
+ * that keep workers fed — and a constant tuned on one host left ~20%
+ * throughput behind on another. The tuner starts from the L2 heuristic
+ * (enough items for the value column of a chunk to fill a 256 KiB L2) and
+ * hill-climbs from there: workers report each chunk's items and wall time,
+ * trials of a few chunks each measure throughput at the current size, and
+ * the size doubles or halves toward whichever direction measures faster,
+ * settling on the best point and re-probing periodically in case the
+ * operating point drifts mid-run.
+ *
+ * chunkItems() is a relaxed atomic load, so producers can consult the
+ * tuner per chunk with no synchronization cost; the trial bookkeeping in
+ * recordChunk() takes a mutex but runs once per chunk, not per item.
+ */
+class ChunkTuner {
+public:
+    /** @brief Target L2 footprint of a chunk's value column. */
+    static constexpr std::size_t kL2Bytes = 256 * 1024;
+
+    /** @brief Smallest chunk the tuner will try. */
+    static constexpr std::size_t kMinChunkItems = 1 << 10;
+
+    /** @brief Largest chunk the tuner will try. */
+    static constexpr std::size_t kMaxChunkItems = 1 << 20;
+
+    /** @brief Chunks measured per trial before a decision is made. */
+    static constexpr std::size_t kChunksPerTrial = 8;
+
+    /** @brief Settled trials to sit out before re-probing. */
+    static constexpr std::size_t kTrialsBetweenProbes = 16;
+
+    /** @brief A new size must beat the best by this factor to win. */
+    static constexpr double kImprovementFactor = 1.05;
+
+    /**
+     * @brief Constructs a tuner starting at the L2-sized heuristic.
+     *
+     * @param initialChunkItems Starting chunk size; defaults to the number
+     *                          of doubles that fit the L2 target.
+     */
+    explicit ChunkTuner(std::size_t initialChunkItems = kL2Bytes / sizeof(double))
+        : chunkItems_(clampChunk(initialChunkItems)),
+          bestChunkItems_(clampChunk(initialChunkItems)) {
+    }
+
+    /**
+     * @brief Process-wide tuner, shared by every pipeline mode.
+     *
+     * One operating point per process: what the pipelined mode learns in
+     * its first seconds also serves later parallel batch passes.
+     */
+    static ChunkTuner& instance() {
+        static ChunkTuner tuner;
+        return tuner;
+    }
+
+    /**
+     * @brief Current recommended chunk size, in items.
+     *
+     * Safe to call from any thread at chunk rate; a relaxed load.
+     */
+    std::size_t chunkItems() const {
+        return chunkItems_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Reports one completed chunk's size and wall time.
+     *
+     * Called by the processing workers. Once kChunksPerTrial chunks have
+     * been measured at the current size, the trial is evaluated and the
+     * recommended size may move.
+     *
+     * @param items Number of items the chunk held.
+     * @param nanos Wall time the chunk took to process.
+     */
+    void recordChunk(std::size_t items, std::uint64_t nanos) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        trialItems_ += items;
+        trialNanos_ += nanos;
+        if (++trialChunks_ >= kChunksPerTrial) {
+            evaluateTrial();
+        }
+    }
+
+    /**
+     * @brief Writes a one-line tuning summary to @p out.
+     */
+    void report(std::ostream& out) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        out << "INFO: Chunk tuner: " << chunkItems_.load(std::memory_order_relaxed)
+            << " items/chunk after " << trialsRun_ << " trial(s)";
+        if (bestThroughput_ > 0.0) {
+            out << ", best " << static_cast<std::uint64_t>(bestThroughput_ * 1e9)
+                << " items/s";
+        }
+        out << "." << std::endl;
+    }
+
+private:
+    /** @brief Which way the next probe moves the chunk size. */
+    enum class Direction { Up, Down };
+
+    static std::size_t clampChunk(std::size_t items) {
+        if (items < kMinChunkItems) {
+            return kMinChunkItems;
+        }
+        if (items > kMaxChunkItems) {
+            return kMaxChunkItems;
+        }
+        return items;
+    }
+
+    /**
+     * @brief Closes the current trial and decides the next chunk size.
+     *
+     * Classic bounded hill climb: a measurably better trial keeps moving in
+     * the same direction, a worse one reverses once, and a second failure
+     * settles back on the best size seen. Settled phases end after
+     * kTrialsBetweenProbes trials so a drifting host is re-measured.
+     * Called with mutex_ held.
+     */
+    void evaluateTrial() {
+        double throughput = trialNanos_ > 0
+                                ? static_cast<double>(trialItems_) / static_cast<double>(trialNanos_)
+                                : 0.0;
+        trialItems_ = 0;
+        trialNanos_ = 0;
+        trialChunks_ = 0;
+        ++trialsRun_;
+
+        std::size_t current = chunkItems_.load(std::memory_order_relaxed);
+        if (settled_) {
+            // Sit on the chosen size for a while, then start a fresh probe.
+            bestThroughput_ = throughput; // Track drift while settled.
+            if (++settledTrials_ >= kTrialsBetweenProbes) {
+                settled_ = false;
+                settledTrials_ = 0;
+                reversed_ = false;
+                direction_ = Direction::Up;
+                chunkItems_.store(step(current), std::memory_order_relaxed);
+            }
+            return;
+        }
+
+        if (bestThroughput_ == 0.0 || throughput > bestThroughput_ * kImprovementFactor) {
+            // Better: remember it and keep moving the same way.
+            bestThroughput_ = throughput;
+            bestChunkItems_ = current;
+            std::size_t next = step(current);
+            if (next == current) {
+                settle();
+            } else {
+                chunkItems_.store(next, std::memory_order_relaxed);
+            }
+        } else if (!reversed_) {
+            // Worse: try the other direction from the best point once.
+            reversed_ = true;
+            direction_ = direction_ == Direction::Up ? Direction::Down : Direction::Up;
+            std::size_t next = step(bestChunkItems_);
+            if (next == bestChunkItems_) {
+                settle();
+            } else {
+                chunkItems_.store(next, std::memory_order_relaxed);
+            }
+        } else {
+            // Worse both ways: the best size is the operating point.
+            settle();
+        }
+    }
+
+    /** @brief Next size in the current probe direction, clamped. */
+    std::size_t step(std::size_t from) const {
+        return clampChunk(direction_ == Direction::Up ? from * 2 : from / 2);
+    }
+
+    /** @brief Locks in the best size seen. Called with mutex_ held. */
+    void settle() {
+        settled_ = true;
+        settledTrials_ = 0;
+        chunkItems_.store(bestChunkItems_, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::size_t> chunkItems_; /**< Current recommendation, read per chunk. */
+
+    mutable std::mutex mutex_;       /**< Guards everything below. */
+    std::size_t trialItems_ = 0;     /**< Items measured in the open trial. */
+    std::uint64_t trialNanos_ = 0;   /**< Wall nanoseconds in the open trial. */
+    std::size_t trialChunks_ = 0;    /**< Chunks measured in the open trial. */
+    std::size_t trialsRun_ = 0;      /**< Completed trials since construction. */
+    std::size_t bestChunkItems_;     /**< Best-measuring size so far. */
+    double bestThroughput_ = 0.0;    /**< Items per nanosecond at the best size. */
+    Direction direction_ = Direction::Up; /**< Current probe direction. */
+    bool reversed_ = false;          /**< Whether this probe already reversed. */
+    bool settled_ = false;           /**< Whether the tuner is sitting on bestChunkItems_. */
+    std::size_t settledTrials_ = 0;  /**< Trials spent settled since the last probe. */
+};
+
+#endif // CHUNK_TUNER_H
+// End of cpp_sample_project/include/ChunkTuner.h
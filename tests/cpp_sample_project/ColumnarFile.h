@@ -0,0 +1,357 @@
+// cpp_sample_project/include/ColumnarFile.h
+
+#ifndef COLUMNAR_FILE_H
+#define COLUMNAR_FILE_H
+
+#include <algorithm> // For std::min/std::max when computing block stats
+#include <cstdint>   // For fixed-width on-disk integer types
+#include <fstream>   // For binary file streams
+#include <iostream>  // For basic logging, consistent with the other handlers
+#include <string>
+#include <vector>
+
+#include "ItemBatch.h" // The in-memory counterpart of the on-disk layout
+
+/**
+ * @brief Versioned binary columnar on-disk format for item batches.
+ *
+ * The file stores items block by block (kDefaultBlockItems per block); within
+ * a block each field is a contiguous column: ids, values, processed flags,
+ * name lengths and the block's name pool. A footer holds the min/max of the
+ * value column per block, so a threshold scan can skip whole blocks that lie
+ * entirely above or below the threshold without reading their columns.
+ *
+ * Layout (all integers little-endian, as written by the host):
+ *
+ *   [magic "SLCB"] [u32 version] [u64 itemCount] [u64 blockCount]
+ *   blockCount x [u64 count]
+ *                [count x i32 ids] [count x f64 values] [count x u8 processed]
+ *                [count x u32 nameLengths] [u64 poolBytes] [poolBytes chars]
+ *   blockCount x [f64 minValue] [f64 maxValue]            <- footer
+ *
+ * Intended as a drop-in alternative to items.json: DataHandler selects this
+ * format by the ".col" file extension.
+ */
+class ColumnarFile {
+public:
+    /** @brief File extension that selects the columnar format. */
+    static constexpr const char* kExtension = ".col";
+
+    /** @brief Current on-disk format version. */
+    static constexpr std::uint32_t kFormatVersion = 1;
+
+    /** @brief Default number of items per column block. */
+    static constexpr std::size_t kDefaultBlockItems = 4096;
+
+    /** @brief Per-block value statistics stored in the footer. */
+    struct BlockStats {
+        double minValue; /**< Smallest item value in the block. */
+        double maxValue; /**< Largest item value in the block. */
+    };
+
+    /**
+     * @brief Returns true if @p path names a columnar file by extension.
+     */
+    static bool matchesPath(const std::string& path) {
+        const std::string ext(kExtension);
+        return path.size() >= ext.size() &&
+               path.compare(path.size() - ext.size(), ext.size(), ext) == 0;
+    }
+
+    /**
+     * @brief Writes a batch to @p path in the columnar format.
+     *
+     * @param path Destination file path.
+     * @param batch The batch to serialize.
+     * @param blockItems Items per block. Defaults to kDefaultBlockItems.
+     * @return bool True on success, false on any I/O failure.
+     */
+    static bool write(const std::string& path, const ItemBatch& batch,
+                      std::size_t blockItems = kDefaultBlockItems) {
+        if (blockItems == 0) {
+            blockItems = kDefaultBlockItems;
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            std::cerr << "ERROR: Could not open '" << path << "' for columnar write." << std::endl;
+            return false;
+        }
+
+        const std::uint64_t itemCount = batch.size();
+        const std::uint64_t blockCount =
+            itemCount == 0 ? 0 : (itemCount + blockItems - 1) / blockItems;
+
+        out.write(kMagic, 4);
+        writePod(out, kFormatVersion);
+        writePod(out, itemCount);
+        writePod(out, blockCount);
+
+        std::vector<BlockStats> stats;
+        stats.reserve(static_cast<std::size_t>(blockCount));
+
+        for (std::uint64_t block = 0; block < blockCount; ++block) {
+            const std::size_t begin = static_cast<std::size_t>(block * blockItems);
+            const std::size_t count =
+                std::min(blockItems, static_cast<std::size_t>(itemCount) - begin);
+
+            writePod(out, static_cast<std::uint64_t>(count));
+
+            // Column blocks: each field contiguous within the block.
+            out.write(reinterpret_cast<const char*>(batch.ids().data() + begin),
+                      static_cast<std::streamsize>(count * sizeof(std::int32_t)));
+            out.write(reinterpret_cast<const char*>(batch.values().data() + begin),
+                      static_cast<std::streamsize>(count * sizeof(double)));
+            out.write(reinterpret_cast<const char*>(batch.processedFlags().data() + begin),
+                      static_cast<std::streamsize>(count * sizeof(std::uint8_t)));
+
+            // Name lengths followed by the block's name pool.
+            std::uint64_t poolBytes = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::uint32_t length =
+                    static_cast<std::uint32_t>(batch.name(begin + i).size());
+                writePod(out, length);
+                poolBytes += length;
+            }
+            writePod(out, poolBytes);
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::string_view name = batch.name(begin + i);
+                out.write(name.data(), static_cast<std::streamsize>(name.size()));
+            }
+
+            // Value statistics for the footer.
+            BlockStats blockStats{batch.values()[begin], batch.values()[begin]};
+            for (std::size_t i = 1; i < count; ++i) {
+                blockStats.minValue = std::min(blockStats.minValue, batch.values()[begin + i]);
+                blockStats.maxValue = std::max(blockStats.maxValue, batch.values()[begin + i]);
+            }
+            stats.push_back(blockStats);
+        }
+
+        // Footer: per-block min/max of the value column.
+        for (const BlockStats& blockStats : stats) {
+            writePod(out, blockStats.minValue);
+            writePod(out, blockStats.maxValue);
+        }
+
+        return static_cast<bool>(out);
+    }
+
+    /**
+     * @brief Reads a whole columnar file back into a batch.
+     *
+     * @param path Source file path.
+     * @param outBatch Receives the deserialized items (cleared implicitly by
+     *                 being appended from empty by the caller's fresh batch).
+     * @return bool True on success, false on open/format errors.
+     */
+    static bool read(const std::string& path, ItemBatch& outBatch) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            std::cerr << "ERROR: Could not open '" << path << "' for columnar read." << std::endl;
+            return false;
+        }
+
+        std::uint64_t itemCount = 0;
+        std::uint64_t blockCount = 0;
+        if (!readHeader(in, itemCount, blockCount)) {
+            std::cerr << "ERROR: '" << path << "' is not a valid columnar item file." << std::endl;
+            return false;
+        }
+
+        outBatch.reserve(static_cast<std::size_t>(itemCount));
+
+        std::vector<std::int32_t> ids;
+        std::vector<double> values;
+        std::vector<std::uint8_t> processed;
+        std::vector<std::uint32_t> nameLengths;
+        std::string namePool;
+
+        for (std::uint64_t block = 0; block < blockCount; ++block) {
+            std::uint64_t count = 0;
+            readPod(in, count);
+            const std::size_t n = static_cast<std::size_t>(count);
+
+            ids.resize(n);
+            values.resize(n);
+            processed.resize(n);
+            nameLengths.resize(n);
+            in.read(reinterpret_cast<char*>(ids.data()),
+                    static_cast<std::streamsize>(n * sizeof(std::int32_t)));
+            in.read(reinterpret_cast<char*>(values.data()),
+                    static_cast<std::streamsize>(n * sizeof(double)));
+            in.read(reinterpret_cast<char*>(processed.data()),
+                    static_cast<std::streamsize>(n * sizeof(std::uint8_t)));
+            in.read(reinterpret_cast<char*>(nameLengths.data()),
+                    static_cast<std::streamsize>(n * sizeof(std::uint32_t)));
+
+            std::uint64_t poolBytes = 0;
+            readPod(in, poolBytes);
+            namePool.resize(static_cast<std::size_t>(poolBytes));
+            in.read(&namePool[0], static_cast<std::streamsize>(poolBytes));
+            if (!in) {
+                std::cerr << "ERROR: Truncated columnar block in '" << path << "'." << std::endl;
+                return false;
+            }
+
+            std::size_t nameOffset = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                outBatch.addItem(ids[i],
+                                 std::string_view(namePool.data() + nameOffset, nameLengths[i]),
+                                 values[i], processed[i] != 0);
+                nameOffset += nameLengths[i];
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Reads only the per-block value statistics from the footer.
+     *
+     * @param path Source file path.
+     * @param outStats Receives one BlockStats entry per block.
+     * @return bool True on success.
+     */
+    static bool readBlockStats(const std::string& path, std::vector<BlockStats>& outStats) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            return false;
+        }
+        std::uint64_t itemCount = 0;
+        std::uint64_t blockCount = 0;
+        if (!readHeader(in, itemCount, blockCount)) {
+            return false;
+        }
+
+        // The footer is the last blockCount * 2 doubles of the file.
+        in.seekg(-static_cast<std::streamoff>(blockCount * 2 * sizeof(double)),
+                 std::ios::end);
+        outStats.resize(static_cast<std::size_t>(blockCount));
+        for (BlockStats& stats : outStats) {
+            readPod(in, stats.minValue);
+            readPod(in, stats.maxValue);
+        }
+        return static_cast<bool>(in);
+    }
+
+    /**
+     * @brief Counts items above @p threshold using the footer statistics.
+     *
+     * Blocks whose minValue already exceeds the threshold are counted
+     * wholesale and blocks whose maxValue is at or below it are skipped;
+     * only straddling blocks have their value column read and scanned.
+     *
+     * @param path Source file path.
+     * @param threshold The classification threshold.
+     * @param outCount Receives the number of items strictly above @p threshold.
+     * @return bool True on success.
+     */
+    static bool countAbove(const std::string& path, double threshold, std::size_t& outCount) {
+        std::vector<BlockStats> stats;
+        if (!readBlockStats(path, stats)) {
+            return false;
+        }
+
+        std::ifstream in(path, std::ios::binary);
+        std::uint64_t itemCount = 0;
+        std::uint64_t blockCount = 0;
+        if (!in || !readHeader(in, itemCount, blockCount)) {
+            return false;
+        }
+
+        outCount = 0;
+        std::vector<double> values;
+        for (std::uint64_t block = 0; block < blockCount; ++block) {
+            std::uint64_t count = 0;
+            readPod(in, count);
+            const std::size_t n = static_cast<std::size_t>(count);
+            const std::size_t idsBytes = n * sizeof(std::int32_t);
+
+            if (stats[static_cast<std::size_t>(block)].minValue > threshold) {
+                // Entire block above: count it without reading the columns.
+                outCount += n;
+                skipBlockColumns(in, n, idsBytes, true);
+            } else if (stats[static_cast<std::size_t>(block)].maxValue <= threshold) {
+                // Entire block at or below: skip it outright.
+                skipBlockColumns(in, n, idsBytes, true);
+            } else {
+                // Straddling block: read just the value column.
+                in.seekg(static_cast<std::streamoff>(idsBytes), std::ios::cur);
+                values.resize(n);
+                in.read(reinterpret_cast<char*>(values.data()),
+                        static_cast<std::streamsize>(n * sizeof(double)));
+                for (double value : values) {
+                    if (value > threshold) {
+                        ++outCount;
+                    }
+                }
+                skipBlockColumns(in, n, 0, false);
+            }
+        }
+        return static_cast<bool>(in);
+    }
+
+private:
+    /** @brief Magic bytes identifying a columnar item file. */
+    static constexpr const char kMagic[5] = "SLCB";
+
+    /** @brief Writes one trivially-copyable value in host byte order. */
+    template <typename T>
+    static void writePod(std::ofstream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /** @brief Reads one trivially-copyable value in host byte order. */
+    template <typename T>
+    static void readPod(std::ifstream& in, T& value) {
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    /**
+     * @brief Validates the magic/version and reads the item and block counts.
+     */
+    static bool readHeader(std::ifstream& in, std::uint64_t& itemCount,
+                           std::uint64_t& blockCount) {
+        char magic[4] = {};
+        in.read(magic, 4);
+        std::uint32_t version = 0;
+        readPod(in, version);
+        if (!in || std::string(magic, 4) != kMagic || version != kFormatVersion) {
+            return false;
+        }
+        readPod(in, itemCount);
+        readPod(in, blockCount);
+        return static_cast<bool>(in);
+    }
+
+    /**
+     * @brief Seeks past the remaining columns of the current block.
+     *
+     * @param in The input stream, positioned after the block's count field
+     *           (or later, if some columns were already consumed).
+     * @param n Number of items in the block.
+     * @param leadingBytes Bytes of already-skipped-over columns still ahead
+     *                     of the stream position (ids and/or values).
+     * @param includeValues True if the value column is still ahead.
+     */
+    static void skipBlockColumns(std::ifstream& in, std::size_t n,
+                                 std::size_t leadingBytes, bool includeValues) {
+        std::streamoff skip = static_cast<std::streamoff>(leadingBytes);
+        if (includeValues) {
+            skip += static_cast<std::streamoff>(n * sizeof(double));
+        }
+        skip += static_cast<std::streamoff>(n * sizeof(std::uint8_t)); // processed
+        in.seekg(skip, std::ios::cur);
+
+        // The stored pool size lets us skip the names without summing the
+        // per-name lengths.
+        in.seekg(static_cast<std::streamoff>(n * sizeof(std::uint32_t)), std::ios::cur);
+        std::uint64_t poolBytes = 0;
+        readPod(in, poolBytes);
+        in.seekg(static_cast<std::streamoff>(poolBytes), std::ios::cur);
+    }
+};
+
+#endif // COLUMNAR_FILE_H
+// End of cpp_sample_project/include/ColumnarFile.h
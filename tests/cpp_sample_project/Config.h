@@ -6,6 +6,8 @@
 #include <string>
 #include <iostream> // For std::cout in getter methods (demonstration)
 
+#include "RuntimeConfig.h" // Snapshot-published runtime overrides
+
 /**
  * @brief Handles configuration settings for the Sample Project 2.
  *
@@ -23,8 +25,11 @@ namespace Config {
 
     /**
      * @brief A processing parameter used by ItemProcessor.
+     *
+     * constexpr so it can also parameterize the compile-time policies in
+     * ProcessingPolicy.h (e.g. ThresholdPolicy<PROCESSING_THRESHOLD>).
      */
-    const int PROCESSING_THRESHOLD = 100;
+    constexpr int PROCESSING_THRESHOLD = 100;
 
     /**
      * @brief Example setting for logging level (could be used by main).
@@ -34,37 +39,73 @@ namespace Config {
     /**
      * @brief Return the configured path for the data file.
      *
-     * @return const std::string& A constant reference to the path string for the data file.
+     * Reads the current runtime snapshot when one has been published (see
+     * RuntimeConfig.h); otherwise the compile-time default. Returned by
+     * value because the snapshot may be replaced at any moment — the copy
+     * is what keeps the caller's string valid across a hot reload.
+     *
+     * @return std::string The path string for the data file.
      */
-    inline const std::string& getDataPath() {
-        // In a real app, this might involve more complex logic,
-        // like checking environment variables first.
-        // For demonstration, printing a message similar to the Python example.
-        // Consider using a proper logging mechanism in a real application.
-        // std::cout << "Config: Providing data file path: " << DATA_FILE_PATH << std::endl;
+    inline std::string getDataPath() {
+        auto snapshot = appconfig::RuntimeConfig::instance().snapshot();
+        if (snapshot != nullptr) {
+            return snapshot->dataFilePath;
+        }
         return DATA_FILE_PATH;
     }
 
     /**
      * @brief Return the configured processing threshold.
      *
+     * One atomic snapshot load when runtime config is active; the
+     * compile-time constant otherwise.
+     *
      * @return int The integer threshold value.
      */
     inline int getThreshold() {
-        // For demonstration, printing a message similar to the Python example.
-        // std::cout << "Config: Providing processing threshold: " << PROCESSING_THRESHOLD << std::endl;
+        auto snapshot = appconfig::RuntimeConfig::instance().snapshot();
+        if (snapshot != nullptr) {
+            return snapshot->processingThreshold;
+        }
         return PROCESSING_THRESHOLD;
     }
 
     /**
      * @brief Return the configured logging level.
      *
-     * @return const std::string& A constant reference to the log level string.
+     * @return std::string The log level string (snapshot or default).
      */
-    inline const std::string& getLogLevel() {
+    inline std::string getLogLevel() {
+        auto snapshot = appconfig::RuntimeConfig::instance().snapshot();
+        if (snapshot != nullptr) {
+            return snapshot->logLevel;
+        }
         return LOG_LEVEL;
     }
 
+    /**
+     * @brief Default location of the optional runtime config file.
+     *
+     * When present, main loads it into the first snapshot and starts the
+     * change watcher; when absent, the constants above apply.
+     */
+    const std::string RUNTIME_CONFIG_PATH = "pipeline.conf";
+
+    /**
+     * @brief Loads the runtime config file (if present) and starts the watcher.
+     *
+     * @return bool True when a snapshot was published from the file.
+     */
+    inline bool initRuntimeConfig() {
+        appconfig::RuntimeConfig& runtime = appconfig::RuntimeConfig::instance();
+        if (!runtime.loadFromFile(RUNTIME_CONFIG_PATH, DATA_FILE_PATH,
+                                  PROCESSING_THRESHOLD, LOG_LEVEL)) {
+            return false;
+        }
+        runtime.startWatcher(RUNTIME_CONFIG_PATH);
+        return true;
+    }
+
 } // namespace Config
 
 #endif // CONFIG_H
@@ -4,11 +4,35 @@
 #define DATA_HANDLER_H
 
 #include <string>
+#include <string_view> // For zero-copy views into the mapped file
 #include <vector>
+#include <map>      // For the simulated raw data records
+#include <variant>  // For the simulated raw data values
+#include <algorithm> // For sorting the shard list
+#include <charconv> // For std::from_chars (in-place number parsing)
 #include <iostream> // For basic logging, consider a dedicated library for real projects
+#include <memory>   // For the shared mapping ownership of lazy-name batches
 #include <stdexcept> // For std::runtime_error or other exceptions
 
-#include "Item.h" // Assuming Item.h is in the same include directory or path is configured
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>   // For shard directory enumeration
+#include <fcntl.h>    // For open
+#include <sys/mman.h> // For mmap/munmap
+#include <sys/stat.h> // For fstat and shard-directory detection
+#include <unistd.h>   // For close
+#define DATA_HANDLER_HAS_MMAP 1
+#endif
+
+#include "Item.h"         // Assuming Item.h is in the same include directory or path is configured
+#include "ItemBatch.h"    // Structure-of-arrays batch container
+#include "BatchErrors.h"  // Non-throwing failure bitmap and error codes
+#include "BoundedQueue.h" // Backpressure queue for the pipelined load mode
+#include "ChunkTuner.h"   // Online chunk-size autotuning for the chunked loader
+#include "ColumnarFile.h" // Binary columnar on-disk format (.col files)
+#include "ItemBatchAbi.h" // Shared C/C++ batch blocks (.batch files)
+#include "Log.h"          // Deferred logging macros for the hot paths
+#include "Serializer.h"   // Allocation-free row formatting for the save path
+#include "Stats.h"        // Per-stage counters and latency histograms
 
 /**
  * @brief Manages loading and saving Item data.
@@ -20,9 +44,256 @@
 class DataHandler {
 private:
     std::string dataSourcePath_; /**< The configured path to the data source (e.g., file path). */
+    OutputBuffer saveBuffer_;    /**< Reusable serialization buffer for batch saves. */
     // In a real app, a logger instance would be preferable.
     // For simplicity, we might use std::cout or a static logger utility.
 
+#ifdef DATA_HANDLER_HAS_MMAP
+    /**
+     * @brief RAII wrapper around a read-only memory-mapped file.
+     *
+     * Holds the mapping for the duration of a parse so the loader can take
+     * string_views directly into the file contents with zero copies.
+     */
+    struct MappedFile {
+        const char* data = nullptr; /**< Start of the mapped region. */
+        std::size_t size = 0;       /**< Length of the mapped region in bytes. */
+        int fd = -1;                /**< Underlying file descriptor. */
+
+        bool open(const std::string& path) {
+            fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return false;
+            }
+            struct stat st {};
+            if (fstat(fd, &st) != 0 || st.st_size == 0) {
+                ::close(fd);
+                fd = -1;
+                return false;
+            }
+            void* base = mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                              PROT_READ, MAP_PRIVATE, fd, 0);
+            if (base == MAP_FAILED) {
+                ::close(fd);
+                fd = -1;
+                return false;
+            }
+            data = static_cast<const char*>(base);
+            size = static_cast<std::size_t>(st.st_size);
+            return true;
+        }
+
+        ~MappedFile() {
+            if (data != nullptr) {
+                munmap(const_cast<char*>(data), size);
+            }
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    };
+#endif // DATA_HANDLER_HAS_MMAP
+
+    /** @brief One simulated source record, as delivered by the fake backend. */
+    using RawRecord = std::map<std::string, std::variant<int, double, std::string>>;
+
+    /**
+     * @brief Extracts the required fields of a simulated record, non-throwing.
+     *
+     * Branch-based replacement for the old std::get + three-catch-clause
+     * pattern: every check is an ordinary conditional on std::get_if, so the
+     * surrounding load loop carries no exception frames. Fields are written
+     * only when the whole record validates.
+     *
+     * @param record The raw source record.
+     * @param id Receives the item id on success.
+     * @param name Receives a pointer to the record's name string on success.
+     * @param value Receives the item value on success.
+     * @return ItemError ItemError::None on success, else the first
+     *         validation failure encountered.
+     */
+    static ItemError extractRecordFields(const RawRecord& record, int& id,
+                                         const std::string*& name, double& value) {
+        auto idField = record.find("item_id");
+        if (idField == record.end()) {
+            return ItemError::MissingId;
+        }
+        auto nameField = record.find("name");
+        if (nameField == record.end()) {
+            return ItemError::MissingName;
+        }
+        auto valueField = record.find("value");
+        if (valueField == record.end()) {
+            return ItemError::MissingValue;
+        }
+        const int* idValue = std::get_if<int>(&idField->second);
+        if (idValue == nullptr) {
+            return ItemError::BadIdType;
+        }
+        const std::string* nameValue = std::get_if<std::string>(&nameField->second);
+        if (nameValue == nullptr) {
+            return ItemError::BadNameType;
+        }
+        const double* doubleValue = std::get_if<double>(&valueField->second);
+        if (doubleValue == nullptr) {
+            // An integral "value" is still a number; accept it as such.
+            const int* intValue = std::get_if<int>(&valueField->second);
+            if (intValue == nullptr) {
+                return ItemError::BadValueType;
+            }
+            value = static_cast<double>(*intValue);
+        } else {
+            value = *doubleValue;
+        }
+        id = *idValue;
+        name = nameValue;
+        return ItemError::None;
+    }
+
+    /**
+     * @brief Advances @p p past JSON whitespace and separators.
+     */
+    static const char* skipJsonFiller(const char* p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' ||
+                           *p == ',' || *p == ':')) {
+            ++p;
+        }
+        return p;
+    }
+
+    /**
+     * @brief Parses one JSON string starting at the opening quote.
+     *
+     * Returns a view between the quotes (escape sequences are kept verbatim,
+     * which is sufficient for the item-name alphabet this pipeline uses) and
+     * advances @p p past the closing quote. Returns an empty view on error.
+     */
+    static std::string_view parseJsonString(const char*& p, const char* end) {
+        if (p >= end || *p != '"') {
+            return {};
+        }
+        const char* start = ++p;
+        while (p < end && *p != '"') {
+            if (*p == '\\' && p + 1 < end) {
+                ++p; // Skip the escaped character.
+            }
+            ++p;
+        }
+        if (p >= end) {
+            return {};
+        }
+        std::string_view result(start, static_cast<std::size_t>(p - start));
+        ++p; // Past the closing quote.
+        return result;
+    }
+
+#ifdef DATA_HANDLER_HAS_MMAP
+    /**
+     * @brief Walks the mapped item array and emits each valid record.
+     *
+     * Shared parsing core for the whole-batch and chunked loaders. For every
+     * flat object with the required "item_id"/"name"/"value" keys, invokes
+     * @p emit(id, name, value) with the name as a view into the mapping.
+     *
+     * Rejected records never throw: each one sets a bit and appends an
+     * error code in @p failures (when provided), keyed by its position in
+     * the source stream, and the parse loop moves straight on.
+     *
+     * @param file The mapped JSON file.
+     * @param emit Callable receiving (int, std::string_view, double).
+     * @param failures Optional failure record for rejected source records.
+     * @return std::size_t Number of records skipped for missing keys.
+     */
+    template <typename EmitFn>
+    static std::size_t parseMappedItems(const MappedFile& file, EmitFn&& emit,
+                                        BatchFailures* failures = nullptr) {
+        const char* p = file.data;
+        const char* end = file.data + file.size;
+        std::size_t skippedRecords = 0;
+        std::size_t recordIndex = 0;
+
+        while (p < end) {
+            // Find the start of the next item object.
+            while (p < end && *p != '{') {
+                ++p;
+            }
+            if (p >= end) {
+                break;
+            }
+            ++p; // Past '{'.
+
+            int id = 0;
+            double value = 0.0;
+            std::string_view name;
+            bool hasId = false;
+            bool hasName = false;
+            bool hasValue = false;
+
+            // Parse the key/value pairs of one flat object.
+            while (p < end) {
+                p = skipJsonFiller(p, end);
+                if (p >= end || *p == '}') {
+                    break;
+                }
+                std::string_view key = parseJsonString(p, end);
+                p = skipJsonFiller(p, end);
+                if (p >= end) {
+                    break;
+                }
+                if (*p == '"') {
+                    std::string_view stringValue = parseJsonString(p, end);
+                    if (key == "name") {
+                        name = stringValue;
+                        hasName = true;
+                    }
+                } else {
+                    // Numeric value: parsed in place, no intermediate string.
+                    if (key == "item_id") {
+                        auto result = std::from_chars(p, end, id);
+                        if (result.ec == std::errc()) {
+                            hasId = true;
+                            p = result.ptr;
+                        } else {
+                            ++p;
+                        }
+                    } else if (key == "value") {
+                        auto result = std::from_chars(p, end, value);
+                        if (result.ec == std::errc()) {
+                            hasValue = true;
+                            p = result.ptr;
+                        } else {
+                            ++p;
+                        }
+                    } else {
+                        // Unknown numeric field: skip the token.
+                        while (p < end && *p != ',' && *p != '}') {
+                            ++p;
+                        }
+                    }
+                }
+            }
+            if (p < end && *p == '}') {
+                ++p; // Past '}'.
+            }
+
+            if (hasId && hasName && hasValue) {
+                emit(id, name, value);
+            } else {
+                ++skippedRecords;
+                if (failures != nullptr) {
+                    failures->recordFailure(recordIndex,
+                                            !hasId ? ItemError::MissingId
+                                            : !hasName ? ItemError::MissingName
+                                                       : ItemError::MissingValue);
+                }
+            }
+            ++recordIndex;
+        }
+
+        return skippedRecords;
+    }
+#endif // DATA_HANDLER_HAS_MMAP
+
 public:
     /**
      * @brief Constructs a new DataHandler object.
@@ -38,6 +309,71 @@ public:
         std::cout << "INFO: DataHandler initialized for source: " << dataSourcePath_ << std::endl;
     }
 
+    /**
+     * @brief Returns true when @p path names a directory of shard files.
+     *
+     * Used by the pipeline entry point to pick between the single-file and
+     * the sharded mode without a separate configuration flag: pointing the
+     * data path at a directory selects sharding.
+     *
+     * @param path The configured data source path.
+     * @return bool True if the path is an existing directory.
+     */
+    static bool isShardDirectory(const std::string& path) {
+#ifdef DATA_HANDLER_HAS_MMAP
+        struct stat fileInfo;
+        return stat(path.c_str(), &fileInfo) == 0 && S_ISDIR(fileInfo.st_mode);
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Enumerates the shard files of a sharded dataset directory.
+     *
+     * Every regular file in the directory is a shard; hidden files and the
+     * pipeline's own ".ckpt" checkpoints are skipped. The list is sorted by
+     * name so shard ordering — and therefore merged accounting — is stable
+     * across runs regardless of readdir order. Each returned path can be
+     * handed to its own DataHandler, which is what keeps the per-shard
+     * pipelines completely independent: no shared file offsets, no shared
+     * parser state.
+     *
+     * @param directory Path to the shard directory.
+     * @return std::vector<std::string> Full paths of the shards, sorted;
+     *         empty when the directory cannot be read.
+     */
+    static std::vector<std::string> listShardFiles(const std::string& directory) {
+        std::vector<std::string> shards;
+#ifdef DATA_HANDLER_HAS_MMAP
+        DIR* dir = opendir(directory.c_str());
+        if (dir == nullptr) {
+            return shards;
+        }
+        while (const dirent* entry = readdir(dir)) {
+            std::string fileName = entry->d_name;
+            if (fileName.empty() || fileName[0] == '.') {
+                continue;
+            }
+            if (fileName.size() > 5 &&
+                fileName.compare(fileName.size() - 5, 5, ".ckpt") == 0) {
+                continue;
+            }
+            std::string fullPath = directory + "/" + fileName;
+            struct stat fileInfo;
+            if (stat(fullPath.c_str(), &fileInfo) == 0 && S_ISREG(fileInfo.st_mode)) {
+                shards.push_back(std::move(fullPath));
+            }
+        }
+        closedir(dir);
+        std::sort(shards.begin(), shards.end());
+#else
+        (void)directory;
+#endif
+        return shards;
+    }
+
     /**
      * @brief Simulate loading items from the data source.
      *
@@ -45,15 +381,20 @@ public:
      * by `dataSourcePath_`. Here, it returns a predefined list for
      * demonstration.
      *
+     * Validation is branch-based and non-throwing (see extractRecordFields);
+     * rejected records land in @p failures as (record, code) entries instead
+     * of exception unwinds or copies of the bad data.
+     *
+     * @param failures Optional failure record; when omitted a summary of any
+     *                 rejections is printed to stderr instead.
      * @return std::vector<Item> A vector of Item objects.
-     * @throws std::runtime_error if data parsing fails for an item.
      */
-    std::vector<Item> loadItems() {
+    std::vector<Item> loadItems(BatchFailures* failures = nullptr) {
         std::cout << "INFO: Simulating loading items from " << dataSourcePath_ << "..." << std::endl;
 
         // Simulate reading data - replace with actual file reading if needed
         // Using a structure similar to the Python example for simulated_data
-        std::vector<std::map<std::string, std::variant<int, double, std::string>>> simulatedRawData = {
+        std::vector<RawRecord> simulatedRawData = {
             {{"item_id", 1}, {"name", "Gadget Alpha"}, {"value", 150.75}},
             {{"item_id", 2}, {"name", "Widget Beta"}, {"value", 85.0}},
             {{"item_id", 3}, {"name", "Thingamajig Gamma"}, {"value", 210.5}},
@@ -64,34 +405,354 @@ public:
         std::vector<Item> items;
         items.reserve(simulatedRawData.size()); // Pre-allocate memory
 
-        for (const auto& dataDict : simulatedRawData) {
-            try {
-                // Basic validation for required keys
-                if (dataDict.count("item_id") && dataDict.count("name") && dataDict.count("value")) {
-                    int id = std::get<int>(dataDict.at("item_id"));
-                    std::string name = std::get<std::string>(dataDict.at("name"));
-                    double value = std::get<double>(dataDict.at("value"));
-
-                    items.emplace_back(id, name, value); // 'processed' defaults to false in Item constructor
-                } else {
-                    std::cerr << "WARNING: Skipping invalid data dictionary during load." << std::endl;
-                    // More detailed logging of dataDict would be good here in a real app.
-                }
-            } catch (const std::bad_variant_access& bva) {
-                std::cerr << "WARNING: Type error creating Item object from data: " << bva.what() << std::endl;
-            } catch (const std::out_of_range& oor) {
-                std::cerr << "WARNING: Missing key when creating Item object: " << oor.what() << std::endl;
-            }
-            // Catching general exceptions is usually not ideal, but for demo:
-            catch (const std::exception& e) {
-                 std::cerr << "WARNING: Generic error creating Item: " << e.what() << std::endl;
+        BatchFailures localFailures;
+        BatchFailures* sink = failures != nullptr ? failures : &localFailures;
+        for (std::size_t record = 0; record < simulatedRawData.size(); ++record) {
+            int id = 0;
+            const std::string* name = nullptr;
+            double value = 0.0;
+            ItemError error = extractRecordFields(simulatedRawData[record], id, name, value);
+            if (error == ItemError::None) {
+                items.emplace_back(id, *name, value); // 'processed' defaults to false in Item constructor
+            } else {
+                sink->recordFailure(record, error);
             }
         }
+        if (failures == nullptr) {
+            localFailures.report(std::cerr);
+        }
 
         std::cout << "INFO: Loaded " << items.size() << " items." << std::endl;
         return items;
     }
 
+    /**
+     * @brief Simulate loading items into a structure-of-arrays batch.
+     *
+     * Column-store counterpart of loadItems(): the same simulated records are
+     * validated the same way — branch-based, non-throwing — but the surviving
+     * items land in an ItemBatch whose id/value/processed columns are
+     * contiguous arrays, so downstream threshold scans stream over dense
+     * memory instead of per-item objects.
+     *
+     * @param failures Optional failure record; when omitted a summary of any
+     *                 rejections is printed to stderr instead.
+     * @return ItemBatch A batch holding all successfully parsed items.
+     */
+    ItemBatch loadItemBatch(BatchFailures* failures = nullptr) {
+        std::cout << "INFO: Simulating loading item batch from " << dataSourcePath_ << "..." << std::endl;
+
+        // Same simulated source records as loadItems().
+        std::vector<RawRecord> simulatedRawData = {
+            {{"item_id", 1}, {"name", "Gadget Alpha"}, {"value", 150.75}},
+            {{"item_id", 2}, {"name", "Widget Beta"}, {"value", 85.0}},
+            {{"item_id", 3}, {"name", "Thingamajig Gamma"}, {"value", 210.5}},
+            {{"item_id", 4}, {"name", "Doohickey Delta"}, {"value", 55.2}},
+            {{"name", "Invalid Item"}, {"value", 10.0}} // Missing item_id
+        };
+
+        ItemBatch batch;
+        batch.reserve(simulatedRawData.size());
+
+        BatchFailures localFailures;
+        BatchFailures* sink = failures != nullptr ? failures : &localFailures;
+        for (std::size_t record = 0; record < simulatedRawData.size(); ++record) {
+            int id = 0;
+            const std::string* name = nullptr;
+            double value = 0.0;
+            ItemError error = extractRecordFields(simulatedRawData[record], id, name, value);
+            if (error == ItemError::None) {
+                batch.addItem(id, *name, value); // 'processed' defaults to false
+            } else {
+                sink->recordFailure(record, error);
+            }
+        }
+        if (failures == nullptr) {
+            localFailures.report(std::cerr);
+        }
+
+        std::cout << "INFO: Loaded batch of " << batch.size() << " items." << std::endl;
+        return batch;
+    }
+
+    /**
+     * @brief Load an item batch from the real JSON file at the data source path.
+     *
+     * The file is memory-mapped read-only and parsed in place: item names are
+     * taken as string_views into the mapping (copied only on the final append
+     * into the batch's name pool) and numbers are converted with
+     * std::from_chars straight into the batch columns. No per-item map,
+     * variant or intermediate string is allocated, so peak memory stays at
+     * the mapping plus the batch itself even for very large inputs.
+     *
+     * The parser expects the pipeline's item schema: a JSON array of flat
+     * objects with "item_id", "name" and "value" keys. Records missing a
+     * required key are skipped with a warning, mirroring loadItems().
+     *
+     * If the file cannot be opened (or the platform lacks mmap), the loader
+     * falls back to the simulated data from loadItemBatch() so the demo
+     * pipeline keeps working without a data directory.
+     *
+     * @param failures Optional failure record for rejected source records;
+     *                 when omitted a summary is printed to stderr instead.
+     * @return ItemBatch A batch holding all successfully parsed items.
+     */
+    ItemBatch loadItemBatchFromFile(BatchFailures* failures = nullptr) {
+        appstats::ScopedStageTimer timer(appstats::PipelineStats::instance().load, 0);
+
+        // A ".batch" extension selects the shared C/C++ ABI block format:
+        // a collector's export is mapped and its columns adopted directly,
+        // with no parsing at all.
+        if (ItemBatchAbi::matchesPath(dataSourcePath_)) {
+            std::cout << "INFO: Loading ABI batch block " << dataSourcePath_ << "..." << std::endl;
+            ItemBatch batch;
+            if (!ItemBatchAbi::read(dataSourcePath_, batch)) {
+                std::cerr << "WARNING: ABI block load failed, falling back to simulated data." << std::endl;
+                return loadItemBatch(failures);
+            }
+            std::cout << "INFO: Loaded batch of " << batch.size()
+                      << " items from ABI block." << std::endl;
+            timer.setItemCount(batch.size());
+            return batch;
+        }
+
+        // A ".col" extension selects the binary columnar format; everything
+        // else goes through the JSON path below.
+        if (ColumnarFile::matchesPath(dataSourcePath_)) {
+            std::cout << "INFO: Loading columnar item file " << dataSourcePath_ << "..." << std::endl;
+            ItemBatch batch;
+            if (!ColumnarFile::read(dataSourcePath_, batch)) {
+                std::cerr << "WARNING: Columnar load failed, falling back to simulated data." << std::endl;
+                return loadItemBatch();
+            }
+            std::cout << "INFO: Loaded batch of " << batch.size() << " items from columnar file." << std::endl;
+            timer.setItemCount(batch.size());
+            return batch;
+        }
+
+#ifdef DATA_HANDLER_HAS_MMAP
+        auto file = std::make_shared<MappedFile>();
+        if (!file->open(dataSourcePath_)) {
+            std::cerr << "WARNING: Could not map data file '" << dataSourcePath_
+                      << "', falling back to simulated data." << std::endl;
+            return loadItemBatch(failures);
+        }
+
+        std::cout << "INFO: Loading items from mapped file " << dataSourcePath_
+                  << " (" << file->size << " bytes)..." << std::endl;
+
+        // Names are recorded lazily as (offset, length) into the mapping —
+        // no hash, copy or pool entry during the load pass. The batch shares
+        // ownership of the mapping, so views stay valid after we return and
+        // the mapping is released with the batch.
+        ItemBatch batch;
+        batch.setNameSource(file, file->data);
+        const char* fileBase = file->data;
+        BatchFailures localFailures;
+        BatchFailures* sink = failures != nullptr ? failures : &localFailures;
+        parseMappedItems(
+            *file, [&batch, fileBase](int id, std::string_view name, double value) {
+                batch.addItemLazy(id, static_cast<std::size_t>(name.data() - fileBase),
+                                  name.size(), value);
+            },
+            sink);
+
+        if (failures == nullptr) {
+            localFailures.report(std::cerr);
+        }
+        // The batch is at its final size: make the dense columns eligible
+        // for huge pages before the processing scans walk them.
+        batch.adviseHugePages();
+        std::cout << "INFO: Loaded batch of " << batch.size() << " items from file." << std::endl;
+        timer.setItemCount(batch.size());
+        return batch;
+#else
+        // No mmap on this platform; use the simulated in-memory data instead.
+        return loadItemBatch(failures);
+#endif
+    }
+
+    /**
+     * @brief Stream the data file into fixed-size chunks for the pipelined mode.
+     *
+     * Parses the mapped file with the same in-place parser as
+     * loadItemBatchFromFile(), but emits ItemBatch chunks of @p chunkItems
+     * items into @p outQueue as soon as they fill up, so processing can start
+     * while loading is still in progress. The bounded queue provides the
+     * backpressure: when processors fall behind, the loader blocks instead of
+     * buffering the whole dataset.
+     *
+     * The queue is intentionally left open on return; the pipeline
+     * orchestrator closes it once the loader thread has finished, which also
+     * covers the multi-producer case.
+     *
+     * When a @p tuner is supplied, the size of each successive chunk is
+     * re-read from it, so the loader follows the autotuner's operating point
+     * as the processing workers report their measurements mid-stream.
+     *
+     * @param chunkItems Number of items per emitted chunk (the starting size
+     *                   when a tuner takes over).
+     * @param outQueue Queue receiving the filled chunks.
+     * @param failures Optional failure record for rejected source records;
+     *                 when omitted a summary is printed to stderr instead.
+     * @param tuner Optional autotuner consulted for each chunk's size.
+     * @return std::size_t Total number of items emitted.
+     */
+    std::size_t loadItemChunks(std::size_t chunkItems, BoundedQueue<ItemBatch>& outQueue,
+                               BatchFailures* failures = nullptr,
+                               ChunkTuner* tuner = nullptr) {
+        appstats::ScopedStageTimer timer(appstats::PipelineStats::instance().load, 0);
+        if (chunkItems == 0) {
+            chunkItems = 1;
+        }
+
+#ifdef DATA_HANDLER_HAS_MMAP
+        auto file = std::make_shared<MappedFile>();
+        if (file->open(dataSourcePath_)) {
+            std::cout << "INFO: Streaming items from mapped file " << dataSourcePath_
+                      << " in chunks of " << chunkItems << "..." << std::endl;
+
+            // Every chunk shares ownership of the one mapping and records its
+            // names lazily; the mapping is unmapped when the last in-flight
+            // chunk is destroyed, wherever in the pipeline that happens.
+            const char* fileBase = file->data;
+            std::size_t chunkTarget = tuner != nullptr ? tuner->chunkItems() : chunkItems;
+            ItemBatch chunk;
+            chunk.reserve(chunkTarget);
+            chunk.setNameSource(file, fileBase);
+            std::size_t totalItems = 0;
+
+            BatchFailures localFailures;
+            BatchFailures* sink = failures != nullptr ? failures : &localFailures;
+            parseMappedItems(
+                *file, [&](int id, std::string_view name, double value) {
+                    chunk.addItemLazy(id, static_cast<std::size_t>(name.data() - fileBase),
+                                      name.size(), value);
+                    if (chunk.size() >= chunkTarget) {
+                        totalItems += chunk.size();
+                        outQueue.push(std::move(chunk));
+                        // The tuner may have moved while this chunk filled.
+                        if (tuner != nullptr) {
+                            chunkTarget = tuner->chunkItems();
+                        }
+                        chunk = ItemBatch();
+                        chunk.reserve(chunkTarget);
+                        chunk.setNameSource(file, fileBase);
+                    }
+                },
+                sink);
+
+            if (!chunk.empty()) {
+                totalItems += chunk.size();
+                outQueue.push(std::move(chunk));
+            }
+            if (failures == nullptr) {
+                localFailures.report(std::cerr);
+            }
+            std::cout << "INFO: Streamed " << totalItems << " items." << std::endl;
+            timer.setItemCount(totalItems);
+            return totalItems;
+        }
+        std::cerr << "WARNING: Could not map data file '" << dataSourcePath_
+                  << "', streaming simulated data instead." << std::endl;
+#endif
+        // Fallback: emit the simulated data as a single chunk.
+        ItemBatch fallback = loadItemBatch(failures);
+        std::size_t totalItems = fallback.size();
+        if (!fallback.empty()) {
+            outQueue.push(std::move(fallback));
+        }
+        return totalItems;
+    }
+
+    /**
+     * @brief Simulate saving a processed item batch back to the data source.
+     *
+     * Column-store counterpart of saveItems(const std::vector<Item>&): the
+     * batch is formatted into a reusable OutputBuffer by the serializer's
+     * table-driven number formatting (see Serializer.h) — no ostringstream,
+     * no locale, no per-item allocation — and only the final file write is
+     * simulated. The buffer is a member, so back-to-back saves settle at
+     * its high-water capacity and stop allocating entirely.
+     *
+     * @param batch A constant reference to the batch to save.
+     * @return bool True if saving was simulated successfully.
+     */
+    bool saveItems(const ItemBatch& batch) {
+        appstats::ScopedStageTimer timer(appstats::PipelineStats::instance().save, batch.size());
+
+        // A ".col" extension selects the binary columnar format: one real
+        // write of the column blocks plus the min/max footer, no per-item
+        // text formatting.
+        if (ColumnarFile::matchesPath(dataSourcePath_)) {
+            std::cout << "INFO: Saving batch of " << batch.size()
+                      << " items to columnar file " << dataSourcePath_ << "..." << std::endl;
+            bool ok = ColumnarFile::write(dataSourcePath_, batch);
+            std::cout << (ok ? "INFO: Columnar save finished."
+                             : "ERROR: Columnar save failed.") << std::endl;
+            return ok;
+        }
+
+        std::cout << "INFO: Simulating saving batch of " << batch.size() << " items to " << dataSourcePath_ << "..." << std::endl;
+
+        std::size_t bytes = serializer::serializeBatch(batch, saveBuffer_);
+
+        std::cout << "INFO: Finished simulating save operation (" << bytes
+                  << " bytes serialized)." << std::endl;
+        return true; // Simulate success
+    }
+
+    /**
+     * @brief Save only the records that changed since the last checkpoint.
+     *
+     * Incremental counterpart of saveItems(const ItemBatch&): consults the
+     * batch's dirty flags and writes just the dirty records plus an index
+     * update, instead of rewriting the full dataset. A checkpoint cycle that
+     * flips a few hundred thousand processed flags in a multi-gigabyte set
+     * then costs I/O proportional to the changes, not the dataset. On
+     * success the batch is marked clean, so back-to-back checkpoints with
+     * no intervening changes write nothing.
+     *
+     * The binary columnar format is block-oriented, so a ".col" target is
+     * skipped entirely when clean but rewritten whole when anything is
+     * dirty; per-block delta writes would need a format revision.
+     *
+     * @param batch The batch to checkpoint; cleared of dirty flags on success.
+     * @return bool True if saving was simulated successfully.
+     */
+    bool saveDirtyItems(ItemBatch& batch) {
+        const std::size_t dirtyCount = batch.dirtyCount();
+        if (dirtyCount == 0) {
+            std::cout << "INFO: No dirty items; skipping save to " << dataSourcePath_ << "." << std::endl;
+            return true;
+        }
+
+        if (ColumnarFile::matchesPath(dataSourcePath_)) {
+            bool ok = saveItems(batch);
+            if (ok) {
+                batch.clearDirty();
+            }
+            return ok;
+        }
+
+        appstats::ScopedStageTimer timer(appstats::PipelineStats::instance().save, dirtyCount);
+
+        std::cout << "INFO: Simulating incremental save of " << dirtyCount << " of "
+                  << batch.size() << " items to " << dataSourcePath_ << "..." << std::endl;
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            if (!batch.isDirty(i)) {
+                continue;
+            }
+            // Deferred DEBUG log; compiles out entirely in release builds.
+            APP_LOG_DEBUG("Saving dirty item: %s", batch.toItem(i).toString().c_str());
+        }
+
+        std::cout << "INFO: Finished simulating incremental save (index updated)." << std::endl;
+        batch.clearDirty();
+        return true;
+    }
+
     /**
      * @brief Simulate saving processed items back to the data source.
      *
@@ -102,13 +763,16 @@ public:
      * @return bool True if saving was simulated successfully, False otherwise (always true here).
      */
     bool saveItems(const std::vector<Item>& items) {
+        appstats::ScopedStageTimer timer(appstats::PipelineStats::instance().save, items.size());
+
         std::cout << "INFO: Simulating saving " << items.size() << " items to " << dataSourcePath_ << "..." << std::endl;
 
         // Simulate writing data - replace with actual file writing if needed
         for (const auto& item : items) {
             // Example: Could convert Item back to JSON and write to file
-            // For demonstration, just "log" the item being saved
-             std::cout << "DEBUG: Saving item: " << item.toString() << std::endl;
+            // For demonstration, just "log" the item being saved.
+            // Deferred DEBUG log; compiles out entirely in release builds.
+            APP_LOG_DEBUG("Saving item: %s", item.toString().c_str());
         }
 
         std::cout << "INFO: Finished simulating save operation." << std::endl;
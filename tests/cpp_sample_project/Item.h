@@ -4,8 +4,8 @@
 #define ITEM_H
 
 #include <string>
+#include <cstdio>   // For std::snprintf in toString
 #include <iostream> // For std::ostream, if we implement operator<<
-#include <iomanip>  // For std::fixed and std::setprecision
 
 /**
  * @brief Represents a single data item to be processed.
@@ -15,7 +15,7 @@
  */
 class Item {
 public:
-    int itemId;         चक : A unique integer identifier for the item.
+    int itemId;         /**< A unique integer identifier for the item. */
     std::string name;   /**< The name of the item. */
     double value;       /**< A numerical value associated with the item. */
     bool processed;     /**< A boolean flag indicating if the item has been processed. */
@@ -50,18 +50,26 @@ public:
     /**
      * @brief Return a user-friendly string representation of the item.
      *
+     * Formats with snprintf into a stack buffer rather than an
+     * std::ostringstream: no locale lock, no stream state, and the only
+     * allocation is the returned string itself. Batch saves avoid even
+     * that by serializing columns directly (see Serializer.h); this method
+     * remains for logging and ad-hoc printing of individual items.
+     *
      * @return std::string A string detailing the item's ID, name, value, and
      *                     processing status.
      */
     std::string toString() const {
-        std::string status = this->processed ? "Processed" : "Pending";
-        // Using a stringstream for formatting to mimic f-string behavior
-        std::ostringstream oss;
-        oss << "Item(ID=" << this->itemId
-            << ", Name='" << this->name
-            << "', Value=" << std::fixed << std::setprecision(2) << this->value
-            << ", Status=" << status << ")";
-        return oss.str();
+        const char* status = this->processed ? "Processed" : "Pending";
+        char buffer[64];
+        int written = std::snprintf(buffer, sizeof(buffer),
+                                    "Item(ID=%d, Name='", this->itemId);
+        std::string result(buffer, written > 0 ? static_cast<std::size_t>(written) : 0);
+        result += this->name;
+        written = std::snprintf(buffer, sizeof(buffer),
+                                "', Value=%.2f, Status=%s)", this->value, status);
+        result.append(buffer, written > 0 ? static_cast<std::size_t>(written) : 0);
+        return result;
     }
 
     /**
@@ -0,0 +1,157 @@
+// cpp_sample_project/include/ItemBatchAbi.h
+
+#ifndef ITEM_BATCH_ABI_READER_H
+#define ITEM_BATCH_ABI_READER_H
+
+#include <cstring>  // For std::memcpy of the header
+#include <fstream>  // For the heap-buffer fallback reader
+#include <iostream> // For load diagnostics
+#include <memory>   // For shared ownership of the mapped block
+#include <string>   // For path handling
+#include <vector>   // For the heap-buffer fallback
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>    // For open
+#include <sys/mman.h> // For mmap/munmap
+#include <sys/stat.h> // For fstat
+#include <unistd.h>   // For close
+#define ITEM_BATCH_ABI_HAS_MMAP 1
+#endif
+
+#include "item_batch_abi.h" // The shared C-ABI layout (from c_sample_project)
+
+#include "ItemBatch.h" // The in-memory batch being populated
+
+/**
+ * @brief Reader for the shared C/C++ columnar batch blocks (.batch files).
+ *
+ * The edge collectors (c_sample_project) export their processed items in
+ * the layout defined by item_batch_abi.h — the single header both sides
+ * compile against. This reader maps a block and populates an ItemBatch by
+ * copying only the dense numeric columns; names stay in the mapped block
+ * as lazy (offset, length) references, with the mapping kept alive by the
+ * batch itself. Compared to the old JSON hop there is no serialization on
+ * the edge and no parsing here: the block's bytes are the handoff.
+ */
+class ItemBatchAbi {
+public:
+    /**
+     * @brief Returns true when @p path names an ABI batch block (".batch").
+     */
+    static bool matchesPath(const std::string& path) {
+        static const std::string kExtension = ".batch";
+        return path.size() > kExtension.size() &&
+               path.compare(path.size() - kExtension.size(), kExtension.size(),
+                            kExtension) == 0;
+    }
+
+    /**
+     * @brief Loads a batch block into @p batch.
+     *
+     * The block is memory-mapped when the platform allows (read into a heap
+     * buffer otherwise) and validated — magic, version, column bounds —
+     * before any column is touched. Ids, values and processed flags are
+     * appended to the batch's columns; each name is recorded as a lazy
+     * reference into the block's name blob, so no name is copied until
+     * something actually reads it.
+     *
+     * @param path Path of the .batch file.
+     * @param batch The batch to append into (typically empty).
+     * @return bool True when the whole block was loaded.
+     */
+    static bool read(const std::string& path, ItemBatch& batch) {
+        std::shared_ptr<const char> block;
+        std::size_t blockBytes = 0;
+        if (!mapOrReadBlock(path, block, blockBytes)) {
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const ItemBatchAbiHeader*>(block.get());
+        if (item_batch_abi_validate(header, blockBytes) == 0) {
+            std::cerr << "ERROR: '" << path
+                      << "' is not a valid ABI batch block." << std::endl;
+            return false;
+        }
+
+        const char* base = block.get();
+        const auto* ids = reinterpret_cast<const std::int32_t*>(base + header->ids_offset);
+        const auto* values = reinterpret_cast<const double*>(base + header->values_offset);
+        const auto* processed =
+            reinterpret_cast<const std::uint8_t*>(base + header->processed_offset);
+        const auto* nameOffsets =
+            reinterpret_cast<const std::uint64_t*>(base + header->name_offsets_offset);
+        const auto* nameLengths =
+            reinterpret_cast<const std::uint32_t*>(base + header->name_lengths_offset);
+        const char* names = base + item_batch_abi_namesOffset(header);
+
+        const auto itemCount = static_cast<std::size_t>(header->item_count);
+        batch.reserve(itemCount);
+        // The batch shares ownership of the block, so the lazy name views
+        // stay valid for its whole lifetime.
+        batch.setNameSource(block, names);
+        for (std::size_t i = 0; i < itemCount; ++i) {
+            batch.addItemLazy(ids[i], static_cast<std::size_t>(nameOffsets[i]),
+                              nameLengths[i], values[i], processed[i] != 0);
+        }
+        batch.adviseHugePages();
+        return true;
+    }
+
+private:
+    /**
+     * @brief Acquires the block bytes: mmap'd where possible, else read whole.
+     *
+     * Either way the storage is owned by the returned shared_ptr, whose
+     * deleter unmaps or frees it once the last batch referencing it is gone.
+     */
+    static bool mapOrReadBlock(const std::string& path,
+                               std::shared_ptr<const char>& block,
+                               std::size_t& blockBytes) {
+#ifdef ITEM_BATCH_ABI_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "ERROR: Could not open ABI batch block '" << path << "'." << std::endl;
+            return false;
+        }
+        struct stat st {};
+        if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            std::cerr << "ERROR: Could not stat ABI batch block '" << path << "'." << std::endl;
+            return false;
+        }
+        std::size_t size = static_cast<std::size_t>(st.st_size);
+        void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping keeps the file alive; the fd is not needed.
+        if (base == MAP_FAILED) {
+            std::cerr << "ERROR: Could not map ABI batch block '" << path << "'." << std::endl;
+            return false;
+        }
+        block = std::shared_ptr<const char>(
+            static_cast<const char*>(base),
+            [size](const char* data) { munmap(const_cast<char*>(data), size); });
+        blockBytes = size;
+        return true;
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            std::cerr << "ERROR: Could not open ABI batch block '" << path << "'." << std::endl;
+            return false;
+        }
+        auto size = static_cast<std::size_t>(in.tellg());
+        auto storage = std::make_shared<std::vector<char>>(size);
+        in.seekg(0);
+        if (!in.read(storage->data(), static_cast<std::streamsize>(size))) {
+            std::cerr << "ERROR: Could not read ABI batch block '" << path << "'." << std::endl;
+            return false;
+        }
+        // Aliasing constructor: the shared_ptr owns the vector but points at
+        // its bytes.
+        block = std::shared_ptr<const char>(storage, storage->data());
+        blockBytes = size;
+        return true;
+#endif
+    }
+};
+
+#endif // ITEM_BATCH_ABI_READER_H
+// End of cpp_sample_project/include/ItemBatchAbi.h
@@ -0,0 +1,234 @@
+// cpp_sample_project/include/Log.h
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <array>   // For the fixed ring storage
+#include <atomic>  // For the lock-free ring indices
+#include <chrono>  // For the drain thread's idle sleep
+#include <cstdarg> // For the printf-style log call
+#include <cstdio>  // For vsnprintf and fwrite
+#include <memory>  // For shared ownership of rings in the registry
+#include <mutex>   // For the (rare) ring registration
+#include <thread>  // For the background drain thread
+#include <vector>  // For the ring registry
+
+/**
+ * @brief Deferred logging subsystem for the hot paths of the pipeline.
+ *
+ * Producers format into a slot of their thread-local lock-free ring buffer
+ * (single producer per ring, no locks, no flush); a background thread drains
+ * all rings to stdout/stderr. This replaces the direct iostream calls that
+ * used to run — with locale-aware formatting and implicit flushes — inside
+ * the per-item processing loop.
+ *
+ * When a ring is full the entry is dropped and counted rather than blocking
+ * the producer; the drop count is reported by the drain thread. Messages are
+ * truncated to the slot size, which is ample for the pipeline's log lines.
+ *
+ * Level filtering happens at compile time via the macros below: in release
+ * builds (NDEBUG) the APP_LOG_DEBUG sites compile to nothing, so the debug
+ * formatting work vanishes from the binary entirely.
+ */
+namespace applog {
+
+/** @brief Severity levels, ordered from most to least verbose. */
+enum class Level { Debug = 0, Info = 1, Warn = 2, Error = 3 };
+
+/**
+ * @brief The asynchronous logger singleton.
+ */
+class AsyncLogger {
+public:
+    /**
+     * @brief Returns the process-wide logger, starting it on first use.
+     */
+    static AsyncLogger& instance() {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    /**
+     * @brief Formats and enqueues one log line (printf-style).
+     *
+     * Runs entirely on the calling thread's ring: one vsnprintf into the
+     * slot plus two relaxed-to-release atomic operations. No locks, no
+     * stream state, no flush.
+     */
+    void log(Level level, const char* fmt, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 3, 4)))
+#endif
+    {
+        Ring& ring = threadRing();
+        const std::size_t head = ring.head.load(std::memory_order_relaxed);
+        const std::size_t tail = ring.tail.load(std::memory_order_acquire);
+        if (head - tail >= Ring::kCapacity) {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return; // Full: drop rather than stall the hot path.
+        }
+
+        Entry& entry = ring.entries[head % Ring::kCapacity];
+        entry.level = level;
+        va_list args;
+        va_start(args, fmt);
+        int written = vsnprintf(entry.text, sizeof(entry.text), fmt, args);
+        va_end(args);
+        entry.length = written < 0 ? 0
+                     : (static_cast<std::size_t>(written) >= sizeof(entry.text)
+                            ? sizeof(entry.text) - 1
+                            : static_cast<std::size_t>(written));
+
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Synchronously drains every ring to the output streams.
+     *
+     * Useful at stage boundaries to keep demo output readable; the drain
+     * thread does the same continuously in the background.
+     */
+    void flush() {
+        std::lock_guard<std::mutex> lock(drainMutex_);
+        drainAllRings();
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+    ~AsyncLogger() {
+        running_.store(false, std::memory_order_release);
+        if (drainThread_.joinable()) {
+            drainThread_.join();
+        }
+        drainAllRings(); // Final drain after the thread has stopped.
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+private:
+    /** @brief One formatted log line, stored in place inside the ring. */
+    struct Entry {
+        Level level;        /**< Severity of the line. */
+        std::size_t length; /**< Number of valid characters in text. */
+        char text[240];     /**< The formatted message (possibly truncated). */
+    };
+
+    /**
+     * @brief Single-producer ring buffer; the drain thread is the consumer.
+     */
+    struct Ring {
+        static constexpr std::size_t kCapacity = 1024;
+
+        std::array<Entry, kCapacity> entries{};
+        std::atomic<std::size_t> head{0};    /**< Next write position (producer). */
+        std::atomic<std::size_t> tail{0};    /**< Next read position (consumer). */
+        std::atomic<std::size_t> dropped{0}; /**< Entries lost to a full ring. */
+    };
+
+    AsyncLogger() {
+        drainThread_ = std::thread([this]() { drainLoop(); });
+    }
+
+    /**
+     * @brief Returns the calling thread's ring, registering it on first use.
+     */
+    Ring& threadRing() {
+        thread_local Ring* ring = nullptr;
+        if (ring == nullptr) {
+            auto owned = std::make_shared<Ring>();
+            ring = owned.get();
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            rings_.push_back(std::move(owned));
+        }
+        return *ring;
+    }
+
+    /**
+     * @brief Background loop: drain all rings, sleep briefly when idle.
+     */
+    void drainLoop() {
+        while (running_.load(std::memory_order_acquire)) {
+            bool drainedAny;
+            {
+                std::lock_guard<std::mutex> lock(drainMutex_);
+                drainedAny = drainAllRings();
+            }
+            if (!drainedAny) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    /**
+     * @brief Drains every registered ring once. Returns true if any entry
+     *        was written out.
+     */
+    bool drainAllRings() {
+        std::vector<std::shared_ptr<Ring>> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            snapshot = rings_;
+        }
+
+        bool drainedAny = false;
+        for (const std::shared_ptr<Ring>& ring : snapshot) {
+            std::size_t tail = ring->tail.load(std::memory_order_relaxed);
+            const std::size_t head = ring->head.load(std::memory_order_acquire);
+            while (tail < head) {
+                const Entry& entry = ring->entries[tail % Ring::kCapacity];
+                writeEntry(entry);
+                ++tail;
+                drainedAny = true;
+            }
+            ring->tail.store(tail, std::memory_order_release);
+
+            const std::size_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0) {
+                std::fprintf(stderr, "WARN: Logger dropped %zu message(s) from a full ring.\n",
+                             dropped);
+            }
+        }
+        return drainedAny;
+    }
+
+    /**
+     * @brief Writes one entry with the pipeline's conventional level prefix.
+     */
+    static void writeEntry(const Entry& entry) {
+        static const char* const kPrefixes[] = {"DEBUG: ", "INFO: ", "WARNING: ", "ERROR: "};
+        std::FILE* stream = (entry.level == Level::Warn || entry.level == Level::Error)
+                                ? stderr : stdout;
+        std::fputs(kPrefixes[static_cast<int>(entry.level)], stream);
+        std::fwrite(entry.text, 1, entry.length, stream);
+        std::fputc('\n', stream);
+    }
+
+    std::mutex registryMutex_;                 /**< Guards rings_. */
+    std::vector<std::shared_ptr<Ring>> rings_; /**< All registered thread rings. */
+    std::mutex drainMutex_;                    /**< Serializes drain passes. */
+    std::atomic<bool> running_{true};          /**< Cleared to stop the drain thread. */
+    std::thread drainThread_;                  /**< The background consumer. */
+};
+
+} // namespace applog
+
+// --- Logging macros with compile-time level stripping ---
+//
+// APP_LOG_DEBUG sites disappear entirely from release (NDEBUG) builds: the
+// arguments are not evaluated and no code is emitted for them.
+
+#define APP_LOG_INFO(...)  ::applog::AsyncLogger::instance().log(::applog::Level::Info,  __VA_ARGS__)
+#define APP_LOG_WARN(...)  ::applog::AsyncLogger::instance().log(::applog::Level::Warn,  __VA_ARGS__)
+#define APP_LOG_ERROR(...) ::applog::AsyncLogger::instance().log(::applog::Level::Error, __VA_ARGS__)
+
+#ifdef NDEBUG
+#define APP_LOG_DEBUG(...) ((void)0)
+#else
+#define APP_LOG_DEBUG(...) ::applog::AsyncLogger::instance().log(::applog::Level::Debug, __VA_ARGS__)
+#endif
+
+#endif // LOG_H
+// End of cpp_sample_project/include/Log.h
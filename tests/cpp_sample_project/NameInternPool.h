@@ -0,0 +1,90 @@
+// cpp_sample_project/include/NameInternPool.h
+
+#ifndef NAME_INTERN_POOL_H
+#define NAME_INTERN_POOL_H
+
+#include <cstdint>       // For std::uint32_t ids
+#include <string_view>   // For zero-copy lookups and views
+#include <unordered_map> // For the hash-cons table
+#include <vector>        // For the id -> string table
+
+#include "Arena.h" // Stable storage for each distinct name
+
+/**
+ * @brief Hash-consing pool mapping item names to stable 32-bit intern ids.
+ *
+ * Each distinct name is stored exactly once in an arena; intern() returns
+ * the same 4-byte id for every occurrence, and view() resolves an id back
+ * to its characters without copying. With the few-thousand-distinct-SKUs /
+ * tens-of-millions-of-rows shape of the real inputs, per-item name storage
+ * collapses from a pointer+length (and a copy of the bytes) to one integer,
+ * and downstream name equality becomes an integer compare instead of a
+ * byte-wise one.
+ *
+ * Arena allocations never move, so the string_views handed out stay valid
+ * for the pool's lifetime; the lookup keys are views into that same arena,
+ * making the table itself allocation-free per entry beyond the bucket node.
+ */
+class NameInternPool {
+public:
+    /**
+     * @brief Pre-sizes the table for an expected number of distinct names.
+     *
+     * @param distinctNames Expected number of unique names.
+     * @param avgNameLength Estimated average name length, used to size the
+     *                      arena (default 16 characters).
+     */
+    void reserve(std::size_t distinctNames, std::size_t avgNameLength = 16) {
+        ids_.reserve(distinctNames);
+        names_.reserve(distinctNames);
+        storage_.reserve(distinctNames * avgNameLength);
+    }
+
+    /**
+     * @brief Returns the id of @p name, interning it on first sight.
+     *
+     * A repeated name costs one hash lookup and no allocation; a new name
+     * additionally costs one arena copy and one table insert.
+     *
+     * @param name The name to intern.
+     * @return std::uint32_t The name's stable intern id.
+     */
+    std::uint32_t intern(std::string_view name) {
+        auto it = ids_.find(name);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+        const char* stored = storage_.copyString(name.data(), name.size());
+        std::string_view storedView(stored, name.size());
+        auto id = static_cast<std::uint32_t>(names_.size());
+        names_.push_back(storedView);
+        ids_.emplace(storedView, id);
+        return id;
+    }
+
+    /**
+     * @brief Resolves an intern id back to its characters.
+     *
+     * @param id An id previously returned by intern().
+     * @return std::string_view The pooled name (not null-terminated).
+     */
+    std::string_view view(std::uint32_t id) const { return names_[id]; }
+
+    /**
+     * @brief Number of distinct names interned so far.
+     */
+    std::size_t size() const { return names_.size(); }
+
+    /**
+     * @brief Bytes of name storage held by the pool's arena.
+     */
+    std::size_t bytesUsed() const { return storage_.bytesUsed(); }
+
+private:
+    std::unordered_map<std::string_view, std::uint32_t> ids_; /**< name -> id. */
+    std::vector<std::string_view> names_; /**< id -> name, in intern order. */
+    Arena storage_;                       /**< Each distinct name's bytes, once. */
+};
+
+#endif // NAME_INTERN_POOL_H
+// End of cpp_sample_project/include/NameInternPool.h
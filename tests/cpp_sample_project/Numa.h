@@ -0,0 +1,183 @@
+// cpp_sample_project/include/Numa.h
+
+#ifndef NUMA_H
+#define NUMA_H
+
+#include <algorithm> // For std::min when slicing partitions
+#include <cstddef>   // For std::size_t
+#include <fstream>   // For reading the sysfs topology files
+#include <sstream>   // For parsing cpulist ranges
+#include <string>
+#include <thread>    // For the pinned first-touch copier threads
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h> // For pthread_setaffinity_np
+#include <sched.h>   // For cpu_set_t
+#define NUMA_HAS_AFFINITY 1
+#endif
+
+#include "ItemBatch.h" // Partitioned into per-node sub-batches
+
+/**
+ * @brief Minimal NUMA topology discovery and thread placement.
+ *
+ * Reads the node layout from /sys/devices/system/node (no libnuma
+ * dependency) and offers CPU-affinity pinning, so the parallel stages can
+ * keep each worker on the socket that owns its partition's memory. Memory
+ * locality itself comes from first touch: a partition is populated by a
+ * thread already pinned to its target node, which makes the kernel place
+ * the pages node-locally. On single-node hosts — or platforms without the
+ * sysfs tree or affinity API — everything degrades to one node covering
+ * all CPUs and pinning becomes a no-op, so callers need no special casing.
+ */
+namespace appnuma {
+
+/**
+ * @brief One NUMA node and the CPUs belonging to it.
+ */
+struct NodeInfo {
+    int node;              /**< Node id (matches the sysfs node directory). */
+    std::vector<int> cpus; /**< Online CPUs local to the node. */
+};
+
+/**
+ * @brief Parses a sysfs cpulist string such as "0-3,8-11" into CPU ids.
+ */
+inline std::vector<int> parseCpuList(const std::string& cpuList) {
+    std::vector<int> cpus;
+    std::istringstream in(cpuList);
+    std::string token;
+    while (std::getline(in, token, ',')) {
+        std::size_t dash = token.find('-');
+        if (dash == std::string::npos) {
+            if (!token.empty()) {
+                cpus.push_back(std::stoi(token));
+            }
+        } else {
+            int first = std::stoi(token.substr(0, dash));
+            int last = std::stoi(token.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief Returns the host's NUMA nodes, discovered once per process.
+ *
+ * Falls back to a single pseudo-node with an empty CPU list (meaning "no
+ * placement constraint") when the sysfs topology is unavailable.
+ */
+inline const std::vector<NodeInfo>& topology() {
+    static const std::vector<NodeInfo> nodes = []() {
+        std::vector<NodeInfo> discovered;
+#if defined(__linux__)
+        for (int node = 0;; ++node) {
+            std::ifstream cpuListFile("/sys/devices/system/node/node" +
+                                      std::to_string(node) + "/cpulist");
+            if (!cpuListFile.is_open()) {
+                break;
+            }
+            std::string cpuList;
+            std::getline(cpuListFile, cpuList);
+            NodeInfo info;
+            info.node = node;
+            info.cpus = parseCpuList(cpuList);
+            if (!info.cpus.empty()) {
+                discovered.push_back(std::move(info));
+            }
+        }
+#endif
+        if (discovered.empty()) {
+            discovered.push_back(NodeInfo{0, {}});
+        }
+        return discovered;
+    }();
+    return nodes;
+}
+
+/**
+ * @brief Number of NUMA nodes with local CPUs (1 on non-NUMA hosts).
+ */
+inline std::size_t nodeCount() { return topology().size(); }
+
+/**
+ * @brief Pins the calling thread to the CPUs of @p nodeIndex.
+ *
+ * @param nodeIndex Index into topology() (not the raw node id).
+ * @return bool True if the affinity was applied; false on platforms without
+ *              an affinity API or for nodes with no CPU constraint, in which
+ *              case the thread keeps running wherever the scheduler put it.
+ */
+inline bool pinThreadToNode(std::size_t nodeIndex) {
+#ifdef NUMA_HAS_AFFINITY
+    const std::vector<NodeInfo>& nodes = topology();
+    if (nodeIndex >= nodes.size() || nodes[nodeIndex].cpus.empty()) {
+        return false;
+    }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (int cpu : nodes[nodeIndex].cpus) {
+        CPU_SET(cpu, &cpuSet);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+    (void)nodeIndex;
+    return false;
+#endif
+}
+
+/**
+ * @brief Splits a batch into one sub-batch per NUMA node with local pages.
+ *
+ * Each partition is populated by a thread pinned to its target node before
+ * it allocates, so first touch places the partition's columns and name
+ * arena in that node's memory. Workers later pinned to the same node then
+ * scan purely local memory instead of paying remote-socket latency. On a
+ * single-node host this returns the source batch's items as one partition
+ * (a plain copy), so the caller's code path is identical everywhere.
+ *
+ * @param source The loaded batch to distribute (left untouched).
+ * @return std::vector<ItemBatch> One partition per node, in node order.
+ */
+inline std::vector<ItemBatch> partitionBatch(const ItemBatch& source) {
+    const std::size_t partitionCount = nodeCount();
+    std::vector<ItemBatch> partitions(partitionCount);
+    if (source.empty()) {
+        return partitions;
+    }
+
+    const std::size_t itemsPerPartition =
+        (source.size() + partitionCount - 1) / partitionCount;
+
+    std::vector<std::thread> copiers;
+    copiers.reserve(partitionCount);
+    for (std::size_t p = 0; p < partitionCount; ++p) {
+        copiers.emplace_back([&source, &partitions, p, itemsPerPartition]() {
+            pinThreadToNode(p); // Pin before allocating: first touch lands locally.
+            const std::size_t begin = p * itemsPerPartition;
+            if (begin >= source.size()) {
+                return;
+            }
+            const std::size_t end = std::min(begin + itemsPerPartition, source.size());
+            ItemBatch& partition = partitions[p];
+            partition.reserve(end - begin);
+            for (std::size_t i = begin; i < end; ++i) {
+                partition.addItem(source.ids()[i], source.name(i), source.values()[i],
+                                  source.processedFlags()[i] != 0);
+            }
+        });
+    }
+    for (std::thread& copier : copiers) {
+        copier.join();
+    }
+    return partitions;
+}
+
+} // namespace appnuma
+
+#endif // NUMA_H
+// End of cpp_sample_project/include/Numa.h
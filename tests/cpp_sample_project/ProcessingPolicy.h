@@ -0,0 +1,124 @@
+// cpp_sample_project/include/ProcessingPolicy.h
+
+#ifndef PROCESSING_POLICY_H
+#define PROCESSING_POLICY_H
+
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::uint8_t
+#include <vector>  // For the classification mask
+
+#include "Config.h"    // Compile-time processing threshold
+#include "ItemBatch.h" // Structure-of-arrays batch container
+
+/**
+ * @brief Classification policy with the threshold baked in at compile time.
+ *
+ * The comparison constant is a template parameter, so instantiations fold it
+ * straight into the instruction stream: no member load, no runtime
+ * indirection in the per-item path. The pipeline's common case is
+ * ThresholdPolicy<Config::PROCESSING_THRESHOLD>.
+ *
+ * @tparam Threshold The exclusive lower bound an item's value must exceed.
+ */
+template <int Threshold>
+struct ThresholdPolicy {
+    /** @brief The folded comparison constant. */
+    static constexpr double kThreshold = static_cast<double>(Threshold);
+
+    /**
+     * @brief Returns true for values the policy classifies as matching.
+     */
+    static constexpr bool matches(double value) { return value > kThreshold; }
+};
+
+/**
+ * @brief Classification policy matching values inside a half-open range.
+ *
+ * A separate instantiation per (Low, High) pair, with both bounds folded at
+ * compile time — rule variants become new instantiations instead of new
+ * branches in a shared per-item path.
+ *
+ * @tparam Low The exclusive lower bound.
+ * @tparam High The inclusive upper bound.
+ */
+template <int Low, int High>
+struct RangePolicy {
+    static_assert(Low < High, "RangePolicy requires Low < High");
+
+    /** @brief The folded lower bound. */
+    static constexpr double kLow = static_cast<double>(Low);
+    /** @brief The folded upper bound. */
+    static constexpr double kHigh = static_cast<double>(High);
+
+    /**
+     * @brief Returns true for values in (Low, High].
+     */
+    static constexpr bool matches(double value) {
+        return value > kLow && value <= kHigh;
+    }
+};
+
+/**
+ * @brief Batch processor specialized at compile time on a classification policy.
+ *
+ * Sibling of the runtime ItemProcessor for callers whose rule is fixed at
+ * build time: Policy::matches() is a constexpr predicate, so the classify
+ * loop below compiles to a straight-line compare against immediate constants
+ * that the optimizer auto-vectorizes, with zero dispatch cost between policy
+ * variants. The runtime ItemProcessor remains the right choice when the
+ * threshold genuinely varies per deployment; this template is for the hot
+ * fixed-rule instantiations.
+ *
+ * @tparam Policy A policy type exposing `static constexpr bool matches(double)`.
+ */
+template <typename Policy>
+class PolicyProcessor {
+public:
+    /**
+     * @brief Classify a dense value array with the policy folded in.
+     *
+     * Writes 1 into @p outMask for each matching value, 0 otherwise. The
+     * predicate is inlined and branch-free, so the loop vectorizes the same
+     * way as the runtime kernels without needing the indirect-call dispatch.
+     *
+     * @param values Pointer to @p count contiguous doubles.
+     * @param count Number of values to classify.
+     * @param outMask Output array of @p count bytes receiving the match mask.
+     */
+    static void classifyBatch(const double* values, std::size_t count,
+                              std::uint8_t* outMask) {
+        for (std::size_t i = 0; i < count; ++i) {
+            outMask[i] = Policy::matches(values[i]) ? 1 : 0;
+        }
+    }
+
+    /**
+     * @brief Process a whole item batch against the compile-time policy.
+     *
+     * Marks every item processed and counts the matches; the quiet
+     * counterpart of ItemProcessor::processChunk for fixed-rule callers.
+     *
+     * @param batch A reference to the ItemBatch to process.
+     * @return std::size_t The number of items the policy matched.
+     */
+    static std::size_t processBatch(ItemBatch& batch) {
+        const std::vector<double>& values = batch.values();
+        std::vector<std::uint8_t> matchMask(values.size());
+        classifyBatch(values.data(), values.size(), matchMask.data());
+
+        std::size_t matchCount = 0;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            matchCount += matchMask[i];
+            batch.markProcessed(i);
+        }
+        return matchCount;
+    }
+};
+
+/**
+ * @brief The pipeline's default compile-time policy: the configured threshold.
+ */
+using DefaultThresholdPolicy = ThresholdPolicy<Config::PROCESSING_THRESHOLD>;
+
+#endif // PROCESSING_POLICY_H
+// End of cpp_sample_project/include/ProcessingPolicy.h
@@ -0,0 +1,239 @@
+// cpp_sample_project/include/Serializer.h
+
+#ifndef SERIALIZER_H
+#define SERIALIZER_H
+
+#include <cstddef>     // For std::size_t
+#include <cstdint>     // For the integer formatting helpers
+#include <cstdio>      // For the snprintf fallback on extreme doubles
+#include <cstring>     // For std::memcpy
+#include <string_view> // For zero-copy name access
+#include <vector>      // For the buffer storage
+
+#include "ItemBatch.h" // The batch being serialized
+
+/**
+ * @brief Reusable byte buffer rows are serialized into.
+ *
+ * Grows geometrically and is meant to be cleared and reused across saves,
+ * so steady-state serialization performs no allocation at all. Writers
+ * reserve a worst-case slice with extend(), format directly into it and
+ * commit the bytes actually produced — no intermediate std::string, no
+ * ostream state.
+ */
+class OutputBuffer {
+public:
+    /**
+     * @brief Pre-allocates capacity for an expected output size.
+     */
+    void reserve(std::size_t bytes) { storage_.reserve(bytes); }
+
+    /**
+     * @brief Forgets the current contents but keeps the capacity.
+     */
+    void clear() { size_ = 0; }
+
+    /**
+     * @brief Start of the serialized bytes.
+     */
+    const char* data() const { return storage_.data(); }
+
+    /**
+     * @brief Number of serialized bytes.
+     */
+    std::size_t size() const { return size_; }
+
+    /**
+     * @brief Ensures @p maxBytes are writable and returns the write cursor.
+     *
+     * The caller formats into the returned pointer and then calls commit()
+     * with one past the last byte written.
+     *
+     * @param maxBytes Upper bound on the bytes about to be written.
+     * @return char* Cursor positioned at the current end of the buffer.
+     */
+    char* extend(std::size_t maxBytes) {
+        if (size_ + maxBytes > storage_.size()) {
+            std::size_t grown = storage_.size() < 4096 ? 4096 : storage_.size() * 2;
+            while (grown < size_ + maxBytes) {
+                grown *= 2;
+            }
+            storage_.resize(grown);
+        }
+        return storage_.data() + size_;
+    }
+
+    /**
+     * @brief Accepts the bytes written after an extend() call.
+     *
+     * @param end One past the last byte the caller produced.
+     */
+    void commit(const char* end) {
+        size_ = static_cast<std::size_t>(end - storage_.data());
+    }
+
+    /**
+     * @brief Appends @p bytes verbatim.
+     */
+    void append(const char* bytes, std::size_t count) {
+        char* out = extend(count);
+        std::memcpy(out, bytes, count);
+        commit(out + count);
+    }
+
+private:
+    std::vector<char> storage_; /**< Backing bytes; only size_ of them are live. */
+    std::size_t size_ = 0;      /**< Serialized bytes committed so far. */
+};
+
+/**
+ * @brief Allocation-free number and row formatting for the save path.
+ *
+ * Replaces the ostringstream formatting in Item::toString for batch saves:
+ * integers are emitted two digits at a time from a lookup table and doubles
+ * at fixed two-decimal precision via scaled integer math — no locale, no
+ * per-call allocation, no printf interpreter. On our save profiles number
+ * formatting dominates CPU, so this is what moves saves from CPU-bound back
+ * to disk-bound.
+ */
+namespace serializer {
+
+/** @brief "00".."99" as one flat table, for two-digits-per-store emission. */
+inline const char* digitPairs() {
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324"
+        "25262728293031323334353637383940414243444546474849"
+        "50515253545556575859606162636465666768697071727374"
+        "75767778798081828384858687888990919293949596979899";
+    return pairs;
+}
+
+/** @brief Worst-case bytes produced for one serialized row (sans name). */
+constexpr std::size_t kMaxRowOverhead = 96;
+
+/**
+ * @brief Writes @p value in decimal, two digits per store.
+ *
+ * @return char* One past the last digit written.
+ */
+inline char* writeUint(char* out, std::uint64_t value) {
+    char scratch[20];
+    char* cursor = scratch + sizeof(scratch);
+    const char* pairs = digitPairs();
+    while (value >= 100) {
+        std::uint64_t pair = (value % 100) * 2;
+        value /= 100;
+        *--cursor = pairs[pair + 1];
+        *--cursor = pairs[pair];
+    }
+    if (value >= 10) {
+        std::uint64_t pair = value * 2;
+        *--cursor = pairs[pair + 1];
+        *--cursor = pairs[pair];
+    } else {
+        *--cursor = static_cast<char>('0' + value);
+    }
+    std::size_t digits = static_cast<std::size_t>(scratch + sizeof(scratch) - cursor);
+    std::memcpy(out, cursor, digits);
+    return out + digits;
+}
+
+/**
+ * @brief Writes a signed integer in decimal.
+ *
+ * @return char* One past the last digit written.
+ */
+inline char* writeInt(char* out, std::int64_t value) {
+    std::uint64_t magnitude;
+    if (value < 0) {
+        *out++ = '-';
+        magnitude = static_cast<std::uint64_t>(-(value + 1)) + 1;
+    } else {
+        magnitude = static_cast<std::uint64_t>(value);
+    }
+    return writeUint(out, magnitude);
+}
+
+/**
+ * @brief Writes @p value with exactly two decimal places.
+ *
+ * Scaled-integer formatting: the value is rounded to hundredths once and
+ * split with integer divides, matching printf's "%.2f" for the magnitudes
+ * this pipeline produces. Values too large for the 64-bit scaled form
+ * (|value| >= ~9.2e16) fall back to snprintf.
+ *
+ * @return char* One past the last byte written.
+ */
+inline char* writeFixed2(char* out, double value) {
+    bool negative = value < 0.0;
+    double magnitude = negative ? -value : value;
+    if (!(magnitude < 9.2e16)) { // Also catches NaN (comparison is false).
+        int written = std::snprintf(out, 32, "%.2f", value);
+        return out + (written > 0 ? written : 0);
+    }
+    auto scaled = static_cast<std::uint64_t>(magnitude * 100.0 + 0.5);
+    if (negative && scaled != 0) {
+        *out++ = '-';
+    }
+    out = writeUint(out, scaled / 100);
+    *out++ = '.';
+    std::uint64_t cents = (scaled % 100) * 2;
+    *out++ = digitPairs()[cents];
+    *out++ = digitPairs()[cents + 1];
+    return out;
+}
+
+/**
+ * @brief Serializes a whole batch into @p out as the pipeline's JSON schema.
+ *
+ * One row per item, matching the loader's expected layout:
+ * `{"item_id": N, "name": "...", "value": X.XX, "processed": B}`. The
+ * buffer is cleared first and can be handed straight to a file write; the
+ * same OutputBuffer reused across saves settles at its high-water capacity
+ * and stops allocating.
+ *
+ * @param batch The batch to serialize.
+ * @param out The reusable buffer receiving the bytes.
+ * @return std::size_t Number of bytes produced.
+ */
+inline std::size_t serializeBatch(const ItemBatch& batch, OutputBuffer& out) {
+    out.clear();
+    out.append("[\n", 2);
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        std::string_view name = batch.name(i);
+        char* cursor = out.extend(kMaxRowOverhead + name.size());
+
+        std::memcpy(cursor, "  {\"item_id\": ", 14);
+        cursor += 14;
+        cursor = writeInt(cursor, batch.ids()[i]);
+        std::memcpy(cursor, ", \"name\": \"", 11);
+        cursor += 11;
+        std::memcpy(cursor, name.data(), name.size());
+        cursor += name.size();
+        std::memcpy(cursor, "\", \"value\": ", 12);
+        cursor += 12;
+        cursor = writeFixed2(cursor, batch.values()[i]);
+        std::memcpy(cursor, ", \"processed\": ", 15);
+        cursor += 15;
+        if (batch.processedFlags()[i] != 0) {
+            std::memcpy(cursor, "true", 4);
+            cursor += 4;
+        } else {
+            std::memcpy(cursor, "false", 5);
+            cursor += 5;
+        }
+        *cursor++ = '}';
+        if (i + 1 < batch.size()) {
+            *cursor++ = ',';
+        }
+        *cursor++ = '\n';
+        out.commit(cursor);
+    }
+    out.append("]\n", 2);
+    return out.size();
+}
+
+} // namespace serializer
+
+#endif // SERIALIZER_H
+// End of cpp_sample_project/include/Serializer.h
@@ -0,0 +1,198 @@
+// cpp_sample_project/include/Stats.h
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <array>   // For the fixed histogram buckets
+#include <atomic>  // For contention-free event recording
+#include <chrono>  // For the scoped stage timers
+#include <cstdint> // For std::uint64_t
+#include <ostream> // For the end-of-run report
+
+/**
+ * @brief Lightweight pipeline statistics: counters and latency histograms.
+ *
+ * Recording an event is two relaxed atomic increments plus a leading-zero
+ * count — a few nanoseconds, cheap enough to leave enabled in production.
+ * Latencies go into log2-spaced buckets (bucket N covers [2^N, 2^(N+1))
+ * nanoseconds), from which approximate p50/p99/p999 are derived at report
+ * time. The report replaces attaching perf externally just to learn which
+ * stage regressed in a given run.
+ */
+namespace appstats {
+
+/**
+ * @brief Log2-bucketed latency histogram with atomic recording.
+ */
+class LatencyHistogram {
+public:
+    /** @brief Number of log2 buckets; covers up to ~2^63 ns. */
+    static constexpr std::size_t kBuckets = 64;
+
+    /**
+     * @brief Records one latency observation.
+     *
+     * @param nanoseconds The observed duration in nanoseconds.
+     */
+    void record(std::uint64_t nanoseconds) {
+        buckets_[bucketFor(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        totalNs_.fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+
+    /** @brief Number of recorded observations. */
+    std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    /** @brief Sum of all recorded durations in nanoseconds. */
+    std::uint64_t totalNs() const { return totalNs_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Approximate percentile from the bucket boundaries.
+     *
+     * Returns the upper bound of the bucket containing the requested rank,
+     * i.e. the true percentile rounded up to the next power of two.
+     *
+     * @param percentile Requested percentile in [0, 100].
+     * @return std::uint64_t The approximate latency in nanoseconds (0 when empty).
+     */
+    std::uint64_t percentileNs(double percentile) const {
+        const std::uint64_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+        std::uint64_t rank =
+            static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(total));
+        if (rank >= total) {
+            rank = total - 1;
+        }
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+            seen += buckets_[bucket].load(std::memory_order_relaxed);
+            if (seen > rank) {
+                return bucket >= 63 ? ~0ull : (1ull << (bucket + 1));
+            }
+        }
+        return 0;
+    }
+
+private:
+    /** @brief Maps a duration to its log2 bucket index. */
+    static std::size_t bucketFor(std::uint64_t nanoseconds) {
+#if defined(__GNUC__)
+        return nanoseconds == 0
+                   ? 0
+                   : static_cast<std::size_t>(63 - __builtin_clzll(nanoseconds));
+#else
+        std::size_t bucket = 0;
+        while (nanoseconds > 1) {
+            nanoseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+#endif
+    }
+
+    std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{}; /**< Per-bucket event counts. */
+    std::atomic<std::uint64_t> count_{0};   /**< Total observations. */
+    std::atomic<std::uint64_t> totalNs_{0}; /**< Sum of observed durations. */
+};
+
+/**
+ * @brief Counters and latency histogram for one pipeline stage.
+ */
+struct StageStats {
+    std::atomic<std::uint64_t> items{0}; /**< Items handled by the stage. */
+    LatencyHistogram latency;            /**< Per-event stage latencies. */
+
+    /**
+     * @brief Records one stage event covering @p itemCount items.
+     */
+    void record(std::uint64_t nanoseconds, std::uint64_t itemCount = 1) {
+        items.fetch_add(itemCount, std::memory_order_relaxed);
+        latency.record(nanoseconds);
+    }
+};
+
+/**
+ * @brief Process-wide statistics for the load/process/save stages.
+ */
+class PipelineStats {
+public:
+    /** @brief Returns the process-wide instance. */
+    static PipelineStats& instance() {
+        static PipelineStats stats;
+        return stats;
+    }
+
+    StageStats load;    /**< Loading / parsing events. */
+    StageStats process; /**< Classification / marking events. */
+    StageStats save;    /**< Serialization / writing events. */
+
+    /**
+     * @brief Prints the per-stage summary (counts, mean, p50/p99/p999).
+     *
+     * @param out Destination stream (typically std::cout at pipeline end).
+     */
+    void report(std::ostream& out) const {
+        out << "INFO: Pipeline stage statistics:" << "\n";
+        reportStage(out, "load", load);
+        reportStage(out, "process", process);
+        reportStage(out, "save", save);
+        out.flush();
+    }
+
+private:
+    PipelineStats() = default;
+
+    static void reportStage(std::ostream& out, const char* stageName,
+                            const StageStats& stage) {
+        const std::uint64_t events = stage.latency.count();
+        out << "INFO:   " << stageName
+            << ": events=" << events
+            << " items=" << stage.items.load(std::memory_order_relaxed)
+            << " total_ns=" << stage.latency.totalNs()
+            << " mean_ns=" << (events != 0 ? stage.latency.totalNs() / events : 0)
+            << " p50_ns<=" << stage.latency.percentileNs(50.0)
+            << " p99_ns<=" << stage.latency.percentileNs(99.0)
+            << " p999_ns<=" << stage.latency.percentileNs(99.9)
+            << "\n";
+    }
+};
+
+/**
+ * @brief RAII timer recording its lifetime into a StageStats on destruction.
+ */
+class ScopedStageTimer {
+public:
+    /**
+     * @param stage The stage the measurement belongs to.
+     * @param itemCount Items covered by this event (recorded on destruction).
+     */
+    explicit ScopedStageTimer(StageStats& stage, std::uint64_t itemCount = 1)
+        : stage_(stage), itemCount_(itemCount),
+          start_(std::chrono::steady_clock::now()) {
+    }
+
+    /** @brief Updates the item count (e.g. once the load size is known). */
+    void setItemCount(std::uint64_t itemCount) { itemCount_ = itemCount; }
+
+    ~ScopedStageTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        stage_.record(static_cast<std::uint64_t>(
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                      itemCount_);
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    StageStats& stage_;                                  /**< Target stage. */
+    std::uint64_t itemCount_;                            /**< Items in this event. */
+    std::chrono::steady_clock::time_point start_;        /**< Construction time. */
+};
+
+} // namespace appstats
+
+#endif // STATS_H
+// End of cpp_sample_project/include/Stats.h
@@ -0,0 +1,211 @@
+// cpp_sample_project/include/ValueAggregator.h
+
+#ifndef VALUE_AGGREGATOR_H
+#define VALUE_AGGREGATOR_H
+
+#include <algorithm> // For std::min/std::max
+#include <cmath>     // For std::frexp, std::ldexp
+#include <cstddef>   // For std::size_t
+#include <cstdint>   // For std::uint64_t
+#include <limits>    // For the min/max sentinels
+#include <ostream>   // For report()
+
+/**
+ * @brief Online accumulator over a stream of item values.
+ *
+ * Maintains count, sum, min and max exactly, plus a small logarithmic
+ * histogram sketch for approximate quantiles (p50/p99), all updated in O(1)
+ * per value. Feeding it from the processing scan means the statistics the
+ * ops reports need come out of the same single pass that sets the processed
+ * flags, instead of a second full read of the saved output.
+ *
+ * The sketch buckets |value| by binary exponent with eight sub-buckets per
+ * octave, so reported quantiles are upper bounds accurate to about 9%.
+ * Unlike appstats::LatencyHistogram the counters here are plain integers:
+ * each worker feeds its own aggregator and the partials are combined with
+ * merge(), so no atomics sit on the per-item path.
+ */
+class ValueAggregator {
+public:
+    /**
+     * @brief Folds one value into the accumulator.
+     *
+     * @param value The item value to aggregate.
+     */
+    void add(double value) {
+        ++count_;
+        sum_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+        ++buckets_[bucketFor(value)];
+    }
+
+    /**
+     * @brief Folds another aggregator's partial results into this one.
+     *
+     * Used to combine per-worker accumulators after a parallel pass.
+     *
+     * @param other The partial aggregate to absorb.
+     */
+    void merge(const ValueAggregator& other) {
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            buckets_[i] += other.buckets_[i];
+        }
+    }
+
+    /**
+     * @brief Returns the number of values aggregated.
+     */
+    std::uint64_t count() const { return count_; }
+
+    /**
+     * @brief Returns the sum of all aggregated values.
+     */
+    double sum() const { return sum_; }
+
+    /**
+     * @brief Returns the mean value, or 0 when empty.
+     */
+    double mean() const { return count_ > 0 ? sum_ / static_cast<double>(count_) : 0.0; }
+
+    /**
+     * @brief Returns the smallest value seen, or 0 when empty.
+     */
+    double minValue() const { return count_ > 0 ? min_ : 0.0; }
+
+    /**
+     * @brief Returns the largest value seen, or 0 when empty.
+     */
+    double maxValue() const { return count_ > 0 ? max_ : 0.0; }
+
+    /**
+     * @brief Approximate quantile from the logarithmic sketch.
+     *
+     * Returns an upper bound on the requested quantile, accurate to one
+     * sub-bucket (about 9%). Values of zero magnitude report as 0.
+     *
+     * @param percentile The quantile in [0, 100], e.g. 50 or 99.
+     * @return double The sketch's upper bound for that quantile.
+     */
+    double percentile(double percentile) const {
+        if (count_ == 0) {
+            return 0.0;
+        }
+        std::uint64_t rank =
+            static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(count_));
+        if (rank >= count_) {
+            rank = count_ - 1;
+        }
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += buckets_[i];
+            if (seen > rank) {
+                return bucketUpperBound(i);
+            }
+        }
+        return max_;
+    }
+
+    /**
+     * @brief Writes a one-line summary of the aggregate to @p out.
+     *
+     * @param out The destination stream.
+     * @param label Name of the value population (e.g. "all", "above-threshold").
+     */
+    void report(std::ostream& out, const char* label) const {
+        out << "INFO:   " << label << ": count=" << count()
+            << " sum=" << sum() << " mean=" << mean()
+            << " min=" << minValue() << " max=" << maxValue()
+            << " p50<=" << percentile(50.0) << " p99<=" << percentile(99.0)
+            << "\n";
+    }
+
+private:
+    /** @brief Sub-buckets per power of two in the quantile sketch. */
+    static constexpr std::size_t kSubBuckets = 8;
+    /** @brief Octaves covered by the sketch (exponents -16..47). */
+    static constexpr int kMinExponent = -16;
+    static constexpr int kMaxExponent = 47;
+    static constexpr std::size_t kBucketCount =
+        static_cast<std::size_t>(kMaxExponent - kMinExponent + 1) * kSubBuckets + 1;
+
+    /**
+     * @brief Maps |value| to its sketch bucket (bucket 0 holds tiny values).
+     */
+    static std::size_t bucketFor(double value) {
+        double magnitude = value < 0.0 ? -value : value;
+        int exponent = 0;
+        double mantissa = std::frexp(magnitude, &exponent); // mantissa in [0.5, 1)
+        if (magnitude == 0.0 || exponent <= kMinExponent) {
+            return 0;
+        }
+        if (exponent > kMaxExponent) {
+            exponent = kMaxExponent;
+            mantissa = 1.0 - 1e-9;
+        }
+        // Sub-bucket from the leading mantissa bits within [0.5, 1).
+        auto sub = static_cast<std::size_t>((mantissa - 0.5) * 2.0 *
+                                            static_cast<double>(kSubBuckets));
+        if (sub >= kSubBuckets) {
+            sub = kSubBuckets - 1;
+        }
+        return static_cast<std::size_t>(exponent - kMinExponent - 1) * kSubBuckets + sub + 1;
+    }
+
+    /**
+     * @brief Upper bound of the values mapped to sketch bucket @p index.
+     */
+    static double bucketUpperBound(std::size_t index) {
+        if (index == 0) {
+            return std::ldexp(1.0, kMinExponent);
+        }
+        std::size_t offset = index - 1;
+        int exponent = kMinExponent + 1 + static_cast<int>(offset / kSubBuckets);
+        std::size_t sub = offset % kSubBuckets;
+        double upperMantissa =
+            0.5 + (static_cast<double>(sub + 1) / static_cast<double>(kSubBuckets)) * 0.5;
+        return std::ldexp(upperMantissa, exponent);
+    }
+
+    std::uint64_t count_ = 0; /**< Number of values aggregated. */
+    double sum_ = 0.0;        /**< Exact running sum. */
+    double min_ = std::numeric_limits<double>::infinity();  /**< Exact minimum. */
+    double max_ = -std::numeric_limits<double>::infinity(); /**< Exact maximum. */
+    std::uint64_t buckets_[kBucketCount] = {}; /**< Logarithmic quantile sketch. */
+};
+
+/**
+ * @brief The two value populations the processing scan aggregates.
+ *
+ * Filled by ItemProcessor during its single classify-and-mark pass: every
+ * item feeds `all`, and items over the threshold additionally feed `above`.
+ */
+struct BatchValueStats {
+    ValueAggregator all;   /**< Statistics over every processed value. */
+    ValueAggregator above; /**< Statistics over values above the threshold. */
+
+    /**
+     * @brief Combines another partial result, for per-worker aggregation.
+     */
+    void merge(const BatchValueStats& other) {
+        all.merge(other.all);
+        above.merge(other.above);
+    }
+
+    /**
+     * @brief Writes both populations' summaries to @p out.
+     */
+    void report(std::ostream& out) const {
+        out << "INFO: Value statistics (from the processing pass):\n";
+        all.report(out, "all");
+        above.report(out, "above-threshold");
+        out.flush();
+    }
+};
+
+#endif // VALUE_AGGREGATOR_H
+// End of cpp_sample_project/include/ValueAggregator.h
@@ -0,0 +1,273 @@
+// cpp_sample_project/benchmarks/ItemBenchmarks.cpp
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>  // For std::remove of temporary data files
+#include <fstream> // For writing the synthetic JSON input
+#include <map>     // For caching generated inputs per size
+#include <random>  // For reproducible synthetic data
+#include <string>
+#include <vector>
+
+#include "ColumnarFile.h"
+#include "DataHandler.h"
+#include "Item.h"
+#include "ItemBatch.h"
+#include "ItemProcessor.h"
+#include "BatchQuery.h"
+#include "ProcessingPolicy.h"
+#include "Serializer.h"
+
+/**
+ * @file Benchmark suite for the sample pipeline's per-stage hot paths.
+ *
+ * Synthetic item sets are generated from a fixed seed, so runs are
+ * reproducible and regressions are attributable to code changes rather than
+ * input drift. Each benchmark reports items/sec (SetItemsProcessed) and,
+ * where a byte volume is meaningful, bytes/sec (SetBytesProcessed).
+ *
+ * Built only when Google Benchmark is available; see CMakeLists.txt.
+ */
+namespace {
+
+/** @brief Seed shared by all generators: keep fixed for reproducibility. */
+constexpr std::uint32_t kSeed = 42;
+
+/**
+ * @brief Generates a deterministic synthetic batch.
+ *
+ * @param itemCount Number of items.
+ * @param minNameLength Shortest generated name.
+ * @param maxNameLength Longest generated name (uniformly distributed).
+ * @return ItemBatch The generated batch; values are uniform in [0, 500).
+ */
+ItemBatch makeSyntheticBatch(std::size_t itemCount, std::size_t minNameLength,
+                             std::size_t maxNameLength) {
+    std::mt19937 rng(kSeed);
+    std::uniform_real_distribution<double> valueDist(0.0, 500.0);
+    std::uniform_int_distribution<std::size_t> lengthDist(minNameLength, maxNameLength);
+    std::uniform_int_distribution<int> charDist('a', 'z');
+
+    ItemBatch batch;
+    batch.reserve(itemCount, (minNameLength + maxNameLength) / 2);
+    std::string name;
+    for (std::size_t i = 0; i < itemCount; ++i) {
+        name.resize(lengthDist(rng));
+        for (char& c : name) {
+            c = static_cast<char>(charDist(rng));
+        }
+        batch.addItem(static_cast<int>(i), name, valueDist(rng));
+    }
+    return batch;
+}
+
+/**
+ * @brief Writes a synthetic batch as the pipeline's JSON item schema.
+ *
+ * @return std::size_t The file size in bytes.
+ */
+std::size_t writeSyntheticJson(const ItemBatch& batch, const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    out << "[\n";
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        out << "  {\"item_id\": " << batch.ids()[i]
+            << ", \"name\": \"" << batch.name(i)
+            << "\", \"value\": " << batch.values()[i] << "}"
+            << (i + 1 < batch.size() ? ",\n" : "\n");
+    }
+    out << "]\n";
+    out.flush();
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(probe.tellg());
+}
+
+/**
+ * @brief Returns (creating on first use) a synthetic JSON file of @p itemCount
+ *        items, plus its size in bytes.
+ */
+const std::pair<std::string, std::size_t>& syntheticJsonFile(std::size_t itemCount) {
+    static std::map<std::size_t, std::pair<std::string, std::size_t>> cache;
+    auto it = cache.find(itemCount);
+    if (it == cache.end()) {
+        std::string path = "bench_items_" + std::to_string(itemCount) + ".json";
+        ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+        std::size_t bytes = writeSyntheticJson(batch, path);
+        it = cache.emplace(itemCount, std::make_pair(std::move(path), bytes)).first;
+    }
+    return it->second;
+}
+
+/**
+ * @brief DataHandler::loadItemBatchFromFile over the mmap'd JSON path.
+ */
+void BM_LoadItemBatchFromFile(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    const auto& input = syntheticJsonFile(itemCount);
+    DataHandler handler(input.first);
+
+    for (auto _ : state) {
+        ItemBatch batch = handler.loadItemBatchFromFile();
+        benchmark::DoNotOptimize(batch);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(input.second));
+}
+BENCHMARK(BM_LoadItemBatchFromFile)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 18);
+
+/**
+ * @brief The vectorized classification kernel alone.
+ */
+void BM_ClassifyBatch(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    ItemProcessor processor(100);
+    std::vector<std::uint8_t> mask(itemCount);
+
+    for (auto _ : state) {
+        processor.classifyBatch(batch.values().data(), itemCount, mask.data());
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(itemCount * sizeof(double)));
+}
+BENCHMARK(BM_ClassifyBatch)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/**
+ * @brief Full quiet chunk processing (classify + mark processed).
+ */
+void BM_ProcessChunk(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    ItemProcessor processor(100);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(processor.processChunk(batch));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+}
+BENCHMARK(BM_ProcessChunk)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/**
+ * @brief Compile-time policy classification (threshold folded as immediate).
+ *
+ * Baseline for the runtime kernels in BM_ClassifyBatch: same scan, but the
+ * comparison constant comes from the ThresholdPolicy template argument
+ * instead of a member load plus indirect kernel call.
+ */
+void BM_PolicyClassifyBatch(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    std::vector<std::uint8_t> mask(itemCount);
+
+    for (auto _ : state) {
+        PolicyProcessor<DefaultThresholdPolicy>::classifyBatch(
+            batch.values().data(), itemCount, mask.data());
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(itemCount * sizeof(double)));
+}
+BENCHMARK(BM_PolicyClassifyBatch)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/**
+ * @brief Item::toString formatting cost.
+ */
+void BM_ItemToString(benchmark::State& state) {
+    Item item(7, "Benchmark Widget", 123.456, false);
+    for (auto _ : state) {
+        std::string text = item.toString();
+        benchmark::DoNotOptimize(text);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ItemToString);
+
+/**
+ * @brief Bounded-heap top-1000 selection over an unsorted batch.
+ *
+ * The query the full-sort baseline below exists to shame: one pass with a
+ * k-entry heap instead of ordering all n items to read off 1000.
+ */
+void BM_TopK(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    constexpr std::size_t kWanted = 1000;
+
+    for (auto _ : state) {
+        std::vector<std::uint32_t> top = batchquery::topK(batch, kWanted);
+        benchmark::DoNotOptimize(top.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+}
+BENCHMARK(BM_TopK)->Arg(1 << 16)->Arg(1 << 20);
+
+/**
+ * @brief Full-sort baseline for the top-1000 question.
+ */
+void BM_TopKFullSort(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    constexpr std::size_t kWanted = 1000;
+
+    for (auto _ : state) {
+        std::vector<std::uint32_t> order(itemCount);
+        for (std::size_t i = 0; i < itemCount; ++i) {
+            order[i] = static_cast<std::uint32_t>(i);
+        }
+        std::sort(order.begin(), order.end(),
+                  [&batch](std::uint32_t a, std::uint32_t b) {
+                      return batch.values()[a] > batch.values()[b];
+                  });
+        order.resize(kWanted < itemCount ? kWanted : itemCount);
+        benchmark::DoNotOptimize(order.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+}
+BENCHMARK(BM_TopKFullSort)->Arg(1 << 16)->Arg(1 << 20);
+
+/**
+ * @brief Whole-batch text serialization via the table-driven formatter.
+ *
+ * Companion to BM_ItemToString: the same logical rows, but emitted by
+ * serializer::serializeBatch into a reused OutputBuffer instead of one
+ * ostringstream-backed string per item.
+ */
+void BM_SerializeBatch(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    OutputBuffer buffer;
+
+    std::int64_t bytes = 0;
+    for (auto _ : state) {
+        bytes = static_cast<std::int64_t>(serializer::serializeBatch(batch, buffer));
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(BM_SerializeBatch)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+/**
+ * @brief Columnar save of a whole batch (the real, non-simulated writer).
+ */
+void BM_SaveItemsColumnar(benchmark::State& state) {
+    const std::size_t itemCount = static_cast<std::size_t>(state.range(0));
+    ItemBatch batch = makeSyntheticBatch(itemCount, 8, 24);
+    const std::string path = "bench_items.col";
+    DataHandler handler(path);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handler.saveItems(batch));
+    }
+    std::remove(path.c_str());
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(itemCount));
+}
+BENCHMARK(BM_SaveItemsColumnar)->Arg(1 << 10)->Arg(1 << 16);
+
+} // namespace
+
+BENCHMARK_MAIN();
+
+// End of cpp_sample_project/benchmarks/ItemBenchmarks.cpp
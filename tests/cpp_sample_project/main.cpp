@@ -1,7 +1,10 @@
 // cpp_sample_project/src/main.cpp
 
+#include <atomic>    // For cross-stage counters in the pipelined mode
+#include <chrono>    // For per-chunk wall times fed to the autotuner
 #include <iostream>
 #include <string>
+#include <thread>    // For the pipelined stage threads
 #include <vector>
 #include <stdexcept> // For std::exception and specific exceptions
 
@@ -9,6 +12,16 @@
 #include "DataHandler.h"   // Generated DataHandler.h
 #include "ItemProcessor.h" // Generated ItemProcessor.h
 #include "Item.h"          // Generated Item.h
+#include "ItemBatch.h"     // Structure-of-arrays batch container
+#include "BatchErrors.h"   // Non-throwing load failure record
+#include "BatchQuery.h"    // Top-K and aggregate queries over the batch
+#include "BoundedQueue.h"  // Backpressure queues for the pipelined mode
+#include "Checkpoint.h"    // Mmap'd processed-state snapshot for resume
+#include "ChunkTuner.h"    // Online chunk-size autotuning
+#include "Log.h"           // Deferred logging subsystem
+#include "Numa.h"          // NUMA topology and batch partitioning
+#include "Stats.h"         // Per-stage counters and latency histograms
+#include "ValueAggregator.h" // Streaming value statistics from the scan
 
 // Basic logging setup (can be expanded with a proper logging library)
 // For simplicity, using std::cout and std::cerr.
@@ -20,6 +33,14 @@
  * In this simple version, it only announces that logging is set up.
  * A real application would configure a logging library here based on Config::LOG_LEVEL.
  */
+/**
+ * @brief Minimum batch size for which the parallel processing stage is used.
+ *
+ * Below this, thread spawn and chunk dispatch cost more than the scan itself
+ * and the serial path (which also logs per item) is the better choice.
+ */
+static constexpr std::size_t kParallelBatchThreshold = 10000;
+
 void setupMainLogging() {
     // Example: Set a global log level or initialize a logger instance.
     // For now, this is a placeholder.
@@ -50,8 +71,16 @@ void runProcessingPipeline() {
         DataHandler dataHandler(dataPath);
         ItemProcessor itemProcessor(threshold);
 
-        // 2. Load data
-        std::vector<Item> itemsToProcess = dataHandler.loadItems();
+        // 2. Load data into the structure-of-arrays batch store.
+        // The loader memory-maps the JSON file and parses it in place,
+        // falling back to simulated data when the file is not present.
+        // The columnar layout keeps the value column dense, which is what the
+        // threshold scan in ItemProcessor::processBatch streams over.
+        // Rejected source records land in a compact failure record (bitmap
+        // plus error codes) instead of throwing inside the parse loop.
+        BatchFailures loadFailures;
+        ItemBatch itemsToProcess = dataHandler.loadItemBatchFromFile(&loadFailures);
+        loadFailures.report(std::cerr);
         if (itemsToProcess.empty()) {
             std::cout << "WARNING: No items loaded from data source. Exiting pipeline." << std::endl;
             std::cout << "INFO: Sample Project 2 processing pipeline finished." << std::endl;
@@ -60,27 +89,76 @@ void runProcessingPipeline() {
 
         std::cout << "INFO: Successfully loaded " << itemsToProcess.size() << " items." << std::endl;
 
-        // 3. Process data items
-        std::vector<Item> processedItems; // To store successfully processed items (optional)
-        processedItems.reserve(itemsToProcess.size());
-        std::vector<Item> failedItems;    // To store failed items (optional)
-
-        for (Item& item : itemsToProcess) { // Process by reference to allow modification
-            // std::cout << "DEBUG: Passing item to processor: " << item.toString() << std::endl; // Python version had this
-            bool success = itemProcessor.processItem(item);
-            if (success) {
-                processedItems.push_back(item);
-            } else {
-                std::cerr << "ERROR: Failed to process item: " << item.toString() << std::endl;
-                failedItems.push_back(item);
+        // Resume support: restore processed flags recorded by a previous
+        // (possibly preempted) run over the same input, so finished work is
+        // not re-processed after a restart.
+        ProcessingCheckpoint checkpoint;
+        std::size_t restoredItems = 0;
+        if (checkpoint.open(dataPath + ".ckpt", itemsToProcess.size())) {
+            restoredItems = checkpoint.restoreInto(itemsToProcess);
+            if (restoredItems > 0) {
+                std::cout << "INFO: Resumed from checkpoint: " << restoredItems
+                          << " of " << itemsToProcess.size()
+                          << " items already processed." << std::endl;
             }
         }
 
-        std::cout << "INFO: Processed " << processedItems.size()
-                  << " items successfully, " << failedItems.size() << " failed." << std::endl;
+        // 3. Process the batch in one pass over the dense value column.
+        // Large batches are split into cache-sized chunks and run across the
+        // work-stealing pool; small ones stay on the serial path.
+        // The processing scan also feeds the streaming value aggregates, so
+        // the sum/mean/max statistics ops wants come out of this same pass
+        // instead of a second read of the saved output.
+        BatchValueStats valueStats;
+        std::size_t aboveThreshold = 0;
+        if (restoredItems == itemsToProcess.size()) {
+            // Every item was completed before the preemption; resume is a
+            // flag copy instead of a full re-process.
+            std::cout << "INFO: Checkpoint covers the whole batch; skipping "
+                      << "the processing stage." << std::endl;
+        } else if (itemsToProcess.size() >= kParallelBatchThreshold &&
+            appnuma::nodeCount() > 1) {
+            // Dual-socket host: redistribute the batch into node-local
+            // partitions and scan each with a worker pinned to its node.
+            std::vector<ItemBatch> partitions = appnuma::partitionBatch(itemsToProcess);
+            aboveThreshold = itemProcessor.processPartitionsNuma(partitions, &valueStats);
+            // Copy the processed flags back so the save below sees them.
+            for (std::size_t i = 0; i < itemsToProcess.size(); ++i) {
+                itemsToProcess.markProcessed(i);
+            }
+        } else if (itemsToProcess.size() >= kParallelBatchThreshold) {
+            // Chunk size comes from the process-wide tuner: its default is
+            // the L2 heuristic, refined by whatever a pipelined run in this
+            // process has measured.
+            aboveThreshold = itemProcessor.processBatchParallel(
+                itemsToProcess, 0, ChunkTuner::instance().chunkItems(), &valueStats);
+        } else {
+            aboveThreshold = itemProcessor.processBatch(itemsToProcess, &valueStats);
+        }
 
-        // 4. Save processed data
-        // In Python example, items_to_process (original list, now modified) was saved.
+        std::cout << "INFO: Processed " << itemsToProcess.size()
+                  << " items successfully, " << aboveThreshold << " above threshold." << std::endl;
+        valueStats.report(std::cout);
+
+        // Ops report: the highest-value items, via bounded selection instead
+        // of a full sort (see BatchQuery.h).
+        constexpr std::size_t kTopReportCount = 3;
+        std::vector<std::uint32_t> topItems =
+            batchquery::topK(itemsToProcess, kTopReportCount);
+        std::cout << "INFO: Top " << topItems.size() << " items by value:" << std::endl;
+        for (std::uint32_t position : topItems) {
+            std::cout << "INFO:   " << itemsToProcess.toItem(position).toString() << std::endl;
+        }
+
+        // Durability point: record the processed flags and cursor, then
+        // msync so a preemption from here on resumes instead of redoing.
+        if (checkpoint.isOpen()) {
+            checkpoint.recordFrom(itemsToProcess);
+            checkpoint.setCursor(itemsToProcess.size());
+            checkpoint.sync();
+        }
+
+        // 4. Save processed data (the batch, now with processed flags set).
         bool saveSuccess = dataHandler.saveItems(itemsToProcess);
 
         if (saveSuccess) {
@@ -106,9 +184,211 @@ void runProcessingPipeline() {
     // Destructors handle resource cleanup in C++.
     // The final log message is placed after the try-catch block.
 
+    // Drain any log lines still sitting in the per-thread rings so the
+    // summary below lands after them.
+    applog::AsyncLogger::instance().flush();
+    appstats::PipelineStats::instance().report(std::cout);
     std::cout << "INFO: Sample Project 2 processing pipeline finished." << std::endl;
 }
 
+/**
+ * @brief Execute the pipeline over a directory of shard files.
+ *
+ * Upstream delivers the dataset pre-sharded (typically 256 files), so
+ * instead of concatenating the shards into one input, each shard runs its
+ * own load -> process -> save pipeline on a worker thread. Shards are
+ * completely independent — separate DataHandler, separate mapping, separate
+ * save target — so the workers share nothing but the shard queue (an atomic
+ * cursor over the sorted shard list) and their per-worker accounting, which
+ * is merged once at the end. Throughput scales with min(shards, cores)
+ * rather than being gated on a single-file stream.
+ *
+ * @param directory Path to the directory holding the shard files.
+ */
+void runShardedProcessingPipeline(const std::string& directory) {
+    std::cout << "INFO: Starting sharded processing over " << directory << "..." << std::endl;
+
+    const std::vector<std::string> shards = DataHandler::listShardFiles(directory);
+    if (shards.empty()) {
+        std::cerr << "WARNING: No shard files found in " << directory
+                  << ". Exiting pipeline." << std::endl;
+        return;
+    }
+
+    const int threshold = Config::getThreshold();
+    std::size_t workerCount = std::thread::hardware_concurrency();
+    if (workerCount == 0) {
+        workerCount = 2;
+    }
+    if (workerCount > shards.size()) {
+        workerCount = shards.size();
+    }
+    std::cout << "INFO: " << shards.size() << " shard(s), "
+              << workerCount << " worker(s), threshold " << threshold << "." << std::endl;
+
+    // Shard scheduler: workers claim the next unprocessed shard until the
+    // list is exhausted, so a slow shard never stalls the others.
+    std::atomic<std::size_t> nextShard(0);
+    std::atomic<std::size_t> totalItems(0);
+    std::atomic<std::size_t> totalAboveThreshold(0);
+    std::atomic<std::size_t> failedShards(0);
+    std::vector<BatchValueStats> workerStats(workerCount);
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (std::size_t w = 0; w < workerCount; ++w) {
+        workers.emplace_back([&, w]() {
+            ItemProcessor itemProcessor(threshold);
+            for (std::size_t shard = nextShard.fetch_add(1); shard < shards.size();
+                 shard = nextShard.fetch_add(1)) {
+                try {
+                    DataHandler shardHandler(shards[shard]);
+                    ItemBatch batch = shardHandler.loadItemBatchFromFile();
+                    if (batch.empty()) {
+                        continue;
+                    }
+                    totalItems += batch.size();
+                    totalAboveThreshold +=
+                        itemProcessor.processChunk(batch, &workerStats[w]);
+                    shardHandler.saveItems(batch);
+                } catch (const std::exception& e) {
+                    // One bad shard should not sink the rest of the dataset.
+                    std::cerr << "ERROR: Shard " << shards[shard]
+                              << " failed: " << e.what() << std::endl;
+                    ++failedShards;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Merged final accounting across all shards.
+    std::cout << "INFO: Sharded run processed " << totalItems.load()
+              << " items across " << shards.size() << " shard(s); "
+              << totalAboveThreshold.load() << " above threshold";
+    if (failedShards.load() > 0) {
+        std::cout << " (" << failedShards.load() << " shard(s) failed)";
+    }
+    std::cout << "." << std::endl;
+
+    BatchValueStats valueStats;
+    for (const BatchValueStats& partial : workerStats) {
+        valueStats.merge(partial);
+    }
+    valueStats.report(std::cout);
+
+    applog::AsyncLogger::instance().flush();
+    appstats::PipelineStats::instance().report(std::cout);
+    std::cout << "INFO: Sharded processing finished." << std::endl;
+}
+
+/**
+ * @brief Execute the pipeline with overlapped load, process and save stages.
+ *
+ * Alternative to runProcessingPipeline() for large inputs: the loader thread
+ * streams fixed-size chunks into a bounded queue, processing workers consume
+ * them, and a writer thread saves completed chunks as they arrive. Loading,
+ * processing and saving therefore overlap, and peak memory is capped at a
+ * few in-flight chunks (queue capacity) instead of the whole dataset.
+ */
+void runPipelinedProcessingPipeline() {
+    std::cout << "INFO: Starting pipelined processing (load -> process -> save)..." << std::endl;
+
+    try {
+        DataHandler dataHandler(Config::getDataPath());
+        ItemProcessor itemProcessor(Config::getThreshold());
+
+        constexpr std::size_t kQueueCapacity = 4; // Chunks buffered per stage.
+
+        // Worker count is sized once from the host's topology; the chunk
+        // size adapts online via the autotuner below.
+        std::size_t processingWorkers = std::thread::hardware_concurrency() / 2;
+        if (processingWorkers < 2) {
+            processingWorkers = 2;
+        }
+
+        BoundedQueue<ItemBatch> loadedChunks(kQueueCapacity);
+        BoundedQueue<ItemBatch> processedChunks(kQueueCapacity);
+
+        std::atomic<std::size_t> totalItems(0);
+        std::atomic<std::size_t> totalAboveThreshold(0);
+        std::atomic<std::size_t> savedChunks(0);
+
+        // The chunk-size operating point differs per host (NVMe vs network
+        // storage); the tuner starts at the L2 heuristic and hill-climbs on
+        // the throughput the workers measure, and the loader re-reads it for
+        // every chunk it cuts.
+        ChunkTuner& tuner = ChunkTuner::instance();
+
+        // Stage 1: loader streams chunks into the first queue.
+        std::thread loader([&]() {
+            totalItems = dataHandler.loadItemChunks(tuner.chunkItems(), loadedChunks,
+                                                    nullptr, &tuner);
+        });
+
+        // Stage 2: workers classify and mark each chunk, then pass it on.
+        // Each worker feeds its own value aggregate; partials are merged
+        // after the queues drain, keeping the per-item path free of sharing.
+        // Chunk wall times feed the tuner, closing the autotuning loop.
+        std::vector<std::thread> processors;
+        std::vector<BatchValueStats> workerStats(processingWorkers);
+        for (std::size_t w = 0; w < processingWorkers; ++w) {
+            processors.emplace_back([&, w]() {
+                ItemBatch chunk;
+                while (loadedChunks.pop(chunk)) {
+                    auto start = std::chrono::steady_clock::now();
+                    totalAboveThreshold += itemProcessor.processChunk(chunk, &workerStats[w]);
+                    auto elapsed = std::chrono::steady_clock::now() - start;
+                    tuner.recordChunk(
+                        chunk.size(),
+                        static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                                .count()));
+                    processedChunks.push(std::move(chunk));
+                }
+            });
+        }
+
+        // Stage 3: writer saves completed chunks incrementally.
+        std::thread writer([&]() {
+            ItemBatch chunk;
+            while (processedChunks.pop(chunk)) {
+                dataHandler.saveItems(chunk);
+                ++savedChunks;
+            }
+        });
+
+        // Shutdown in stage order: each queue closes once its producers are done.
+        loader.join();
+        loadedChunks.close();
+        for (std::thread& processor : processors) {
+            processor.join();
+        }
+        processedChunks.close();
+        writer.join();
+
+        std::cout << "INFO: Pipelined run processed " << totalItems.load()
+                  << " items in " << savedChunks.load() << " chunk(s); "
+                  << totalAboveThreshold.load() << " above threshold." << std::endl;
+
+        BatchValueStats valueStats;
+        for (const BatchValueStats& partial : workerStats) {
+            valueStats.merge(partial);
+        }
+        valueStats.report(std::cout);
+        tuner.report(std::cout);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "CRITICAL: An unexpected standard exception occurred: " << e.what() << std::endl;
+    }
+
+    applog::AsyncLogger::instance().flush();
+    appstats::PipelineStats::instance().report(std::cout);
+    std::cout << "INFO: Pipelined processing finished." << std::endl;
+}
+
 /**
  * @brief Main entry point for the application.
  *
@@ -117,14 +397,31 @@ void runProcessingPipeline() {
  * @return int Exit code (0 for success, non-zero for errors).
  */
 int main(int argc, char* argv[]) {
-    // Basic command-line argument parsing could be added here if needed,
-    // using argc and argv, or a library like cxxopts or Boost.Program_options.
-    // For this example, we are not parsing command-line arguments.
-    (void)argc; // Suppress unused parameter warning
-    (void)argv; // Suppress unused parameter warning
-
     setupMainLogging();
-    runProcessingPipeline();
+
+    // Optional runtime config: when pipeline.conf exists its values
+    // override the compile-time constants and a watcher republishes on
+    // edit, so threshold/path changes no longer need a rebuild.
+    if (Config::initRuntimeConfig()) {
+        std::cout << "INFO: Runtime config active (watching "
+                  << Config::RUNTIME_CONFIG_PATH << ")." << std::endl;
+    }
+
+    // "--pipelined" selects the overlapped load/process/save mode and
+    // "--shards <dir>" the per-shard worker mode; a data path that names a
+    // directory also selects sharding. The default remains the sequential
+    // pipeline.
+    if (argc > 1 && std::string(argv[1]) == "--pipelined") {
+        runPipelinedProcessingPipeline();
+    } else if (argc > 2 && std::string(argv[1]) == "--shards") {
+        runShardedProcessingPipeline(argv[2]);
+    } else if (DataHandler::isShardDirectory(Config::getDataPath())) {
+        runShardedProcessingPipeline(Config::getDataPath());
+    } else {
+        runProcessingPipeline();
+    }
+
+    appconfig::RuntimeConfig::instance().stopWatcher();
     return 0; // Indicate successful execution
 }
 